@@ -0,0 +1,128 @@
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "../sources/configuration/configuration_handler.h"
+#include "../sources/daemon/plan_server.h"
+#include "../sources/navmesh/navmesh.h"
+#include "../sources/navmesh/polygon_file.h"
+#include "../sources/planner/planner_service.h"
+
+namespace
+{
+    std::atomic<bool> stop(false);
+
+    void requestStop(int)
+    {
+        stop.store(true);
+    }
+
+    void printUsage(const char *program)
+    {
+        std::cerr << "Usage: " << program << " [--socket <path>] [--config <ini file>]"
+                  << " [--log <request log>]"
+                  << " [--table <min x> <min y> <max x> <max y> [--polygons <polygon file>]]" << std::endl
+                  << "Serves planning requests on a Unix domain socket until SIGINT or SIGTERM." << std::endl
+                  << "The tables are built once at startup, with the configuration file if any." << std::endl
+                  << "--polygons adds the fixed obstacles of the file to the table, one per line :" << std::endl
+                  << "  polygon <x> <y> <x> <y> <x> <y> ..." << std::endl
+                  << "With --log, every request is logged for kraken_replay." << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string socket_path = "/tmp/kraken.sock";
+    std::string config_filename;
+    std::string log_filename;
+    std::string polygons_filename;
+    bool has_table = false;
+    float table[4] = {};
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--socket") == 0 && i + 1 < argc)
+            socket_path = argv[++i];
+        else if (std::strcmp(argv[i], "--config") == 0 && i + 1 < argc)
+            config_filename = argv[++i];
+        else if (std::strcmp(argv[i], "--log") == 0 && i + 1 < argc)
+            log_filename = argv[++i];
+        else if (std::strcmp(argv[i], "--polygons") == 0 && i + 1 < argc)
+            polygons_filename = argv[++i];
+        else if (std::strcmp(argv[i], "--table") == 0 && i + 4 < argc)
+        {
+            has_table = true;
+            for (auto &bound : table)
+                bound = static_cast<float>(std::atof(argv[++i]));
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+    if ((has_table && !(table[0] < table[2] && table[1] < table[3])) || (!has_table && !polygons_filename.empty()))
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    try
+    {
+        kraken::ConfigurationHandler handler;
+        if (!config_filename.empty())
+        {
+            std::ifstream config_file(config_filename);
+            if (!config_file)
+                throw std::invalid_argument("Cannot open " + config_filename + ".");
+            std::ostringstream content;
+            content << config_file.rdbuf();
+            handler.loadFromString(content.str());
+        }
+
+        kraken::PlannerService service(handler);
+        std::ofstream log_file;
+        if (!log_filename.empty())
+        {
+            log_file.open(log_filename, std::ios::binary);
+            if (!log_file)
+                throw std::invalid_argument("Cannot write " + log_filename + ".");
+            service.setRequestLog(&log_file);
+        }
+        if (has_table)
+        {
+            auto navmesh = std::make_shared<kraken::Navmesh>(kraken::Vector2D(table[0], table[1]),
+                                                             kraken::Vector2D(table[2], table[3]));
+            if (!polygons_filename.empty())
+            {
+                std::ifstream polygons_file(polygons_filename);
+                if (!polygons_file)
+                    throw std::invalid_argument("Cannot open " + polygons_filename + ".");
+                auto polygons = kraken::polygon_file::parse(polygons_file);
+                for (const auto &polygon : polygons)
+                    navmesh->addPolygon(polygon);
+                std::cout << polygons.size() << " fixed obstacles loaded from " << polygons_filename << std::endl;
+            }
+            service.setNavmesh(std::move(navmesh));
+        }
+
+        kraken::PlanServer server(service, socket_path);
+        std::signal(SIGINT, requestStop);
+        std::signal(SIGTERM, requestStop);
+        std::cout << "Listening on " << socket_path << std::endl;
+        server.run(stop);
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+}
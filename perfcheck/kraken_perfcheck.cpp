@@ -0,0 +1,126 @@
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "../sources/perfcheck/perf_baseline.h"
+#include "../sources/perfcheck/perf_scenario.h"
+
+#ifndef KRAKEN_PERFCHECK_DIR
+#define KRAKEN_PERFCHECK_DIR "perfcheck"
+#endif
+
+// CMAKE_BUILD_TYPE of the library : the latencies only compare between builds of the same optimization level
+#ifndef KRAKEN_PERFCHECK_BUILD_TYPE
+#define KRAKEN_PERFCHECK_BUILD_TYPE ""
+#endif
+
+namespace
+{
+    void printUsage(const char *program)
+    {
+        std::cerr << "Usage: " << program << " [--scenarios <file>] [--baseline <file>] [--repetitions <n>]"
+                  << " [--tolerance <ratio>] [--update]" << std::endl
+                  << "Plans the scenarios and compares the latencies and the node counts of each request with the"
+                  << " baseline."
+                  << std::endl
+                  << "Exit status: 0 if no regression, 1 on a significant regression, 2 on an error." << std::endl
+                  << "--update rewrites the baseline with the measures instead." << std::endl
+                  << "Only runs in a Release build, the build type of the baseline." << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string scenarios_filename = KRAKEN_PERFCHECK_DIR "/scenarios.txt";
+    std::string baseline_filename = KRAKEN_PERFCHECK_DIR "/baseline.txt";
+    int repetitions = 20;
+    float tolerance = 0.1f;
+    bool update = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--scenarios") == 0 && has_value)
+            scenarios_filename = argv[++i];
+        else if (std::strcmp(argv[i], "--baseline") == 0 && has_value)
+            baseline_filename = argv[++i];
+        else if (std::strcmp(argv[i], "--repetitions") == 0 && has_value)
+            repetitions = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--tolerance") == 0 && has_value)
+            tolerance = static_cast<float>(std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "--update") == 0)
+            update = true;
+        else
+        {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+    if (repetitions <= 0 || tolerance < 0)
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    const std::string build_type = KRAKEN_PERFCHECK_BUILD_TYPE;
+    if (build_type != "Release")
+    {
+        std::cerr << "kraken_perfcheck measures a Release build, this one is \"" << build_type << "\"."
+                  << " Configure with -DCMAKE_BUILD_TYPE=Release." << std::endl;
+        return 2;
+    }
+
+    try
+    {
+        std::ifstream scenarios_file(scenarios_filename);
+        if (!scenarios_file)
+            throw std::invalid_argument("Cannot open " + scenarios_filename + ".");
+        auto scenarios = kraken::perf_scenario::parse(scenarios_file);
+
+        std::vector<kraken::PerfMeasure> measures;
+        for (const auto &scenario : scenarios)
+        {
+            measures.push_back(kraken::perf_scenario::run(scenario, repetitions));
+            const auto &measure = measures.back();
+            std::cout << measure.name << ": p50=" << measure.p50_us << "us p99=" << measure.p99_us << "us nodes="
+                      << measure.nodes_expanded << " failures=" << measure.failures << std::endl;
+        }
+
+        if (update)
+        {
+            std::ofstream baseline_file(baseline_filename);
+            if (!baseline_file)
+                throw std::invalid_argument("Cannot write " + baseline_filename + ".");
+            kraken::perf_baseline::write(baseline_file, build_type, measures);
+            std::cout << "Baseline written to " << baseline_filename << std::endl;
+            return 0;
+        }
+
+        std::ifstream baseline_file(baseline_filename);
+        if (!baseline_file)
+            throw std::invalid_argument("Cannot open " + baseline_filename + ".");
+        std::string baseline_build_type;
+        auto baseline = kraken::perf_baseline::parse(baseline_file, baseline_build_type);
+        if (baseline_build_type != build_type)
+            throw std::invalid_argument("The baseline was measured on a " + baseline_build_type + " build, this is a "
+                                        + build_type + " build.");
+
+        // One sign test per request, corrected for their number
+        bool regression = false;
+        for (const auto &comparison : kraken::perf_baseline::compare(baseline, measures, tolerance))
+        {
+            std::cout << comparison;
+            regression |= comparison.isRegression();
+        }
+        std::cout << (regression ? "Performance regression" : "No performance regression") << std::endl;
+        return regression ? 1 : 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+}
@@ -0,0 +1,84 @@
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "../sources/configuration/configuration_handler.h"
+#include "../sources/planner/planner_service.h"
+#include "../sources/replay/request_replayer.h"
+
+namespace
+{
+    void printUsage(const char *program)
+    {
+        std::cerr << "Usage: " << program << " <request log> [--config <ini file>]" << std::endl
+                  << "Plans again the requests of a log, with the configuration sections recorded with each one,"
+                  << " and compares the itineraries with the recorded ones." << std::endl
+                  << "Exit status: 0 if every itinerary is identical, 1 on a mismatch, 2 on an error." << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string log_filename;
+    std::string config_filename;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--config") == 0 && i + 1 < argc)
+            config_filename = argv[++i];
+        else if (log_filename.empty() && argv[i][0] != '-')
+            log_filename = argv[i];
+        else
+        {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+    if (log_filename.empty())
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    try
+    {
+        kraken::ConfigurationHandler handler;
+        if (!config_filename.empty())
+        {
+            std::ifstream config_file(config_filename);
+            if (!config_file)
+                throw std::invalid_argument("Cannot open " + config_filename + ".");
+            std::ostringstream content;
+            content << config_file.rdbuf();
+            handler.loadFromString(content.str());
+        }
+
+        std::ifstream log_file(log_filename, std::ios::binary);
+        if (!log_file)
+            throw std::invalid_argument("Cannot open " + log_filename + ".");
+
+        std::ostringstream statistics;
+        kraken::PlannerService service(handler, statistics);
+        auto context = service.createContext();
+        kraken::RequestReplayer replayer(handler, [&](const kraken::PlanningRequest &request) {
+            auto obstacles = service.createObstacleSet();
+            for (const auto &obstacle : request.obstacles)
+                obstacles.add(obstacle);
+            std::vector<kraken::ItineraryPoint> itinerary;
+            context->plan(request.start, request.goal, obstacles, itinerary);
+            return itinerary;
+        });
+
+        auto report = replayer.replay(log_file);
+        std::cout << report;
+        return report.mismatch_count == 0 ? 0 : 1;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+}
@@ -0,0 +1,197 @@
+#include "kraken_api.h"
+
+#include <exception>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "../configuration/configuration_handler.h"
+#include "../planner/planner_service.h"
+
+struct kraken_planner
+{
+    kraken_planner() : service(configuration_handler, statistics), context(service.createContext()),
+                       obstacles(new kraken::DynamicObstacleSet(service.createObstacleSet()))
+    {
+
+    }
+
+    /**
+     * Loads a configuration, then reserves the obstacle set for its ObstaclesMemoryPoolSize
+     * @param configuration
+     */
+    void load(const char *configuration)
+    {
+        configuration_handler.loadFromString(configuration);
+        obstacles.reset(new kraken::DynamicObstacleSet(service.createObstacleSet()));
+    }
+
+    kraken::ConfigurationHandler configuration_handler;
+    //The statistics are only polled through the service : the dumps of EnableDebug go to a stream without buffer,
+    //which discards them, so that a long-lived host doesn't accumulate them
+    std::ostream statistics{nullptr};
+    kraken::PlannerService service;
+    std::unique_ptr<kraken::PlanningContext> context;
+    //Its capacity is fixed : the set is replaced when the configuration changes
+    std::unique_ptr<kraken::DynamicObstacleSet> obstacles;
+    std::vector<kraken::ItineraryPoint> itinerary;
+};
+
+namespace
+{
+    kraken::Kinematic toKinematic(const kraken_kinematic &kinematic)
+    {
+        return kraken::Kinematic(kinematic.x, kinematic.y, kinematic.orientation, kinematic.going_forward != 0,
+                                 kinematic.curvature, false);
+    }
+}
+
+int kraken_api_version(void)
+{
+    return KRAKEN_API_VERSION;
+}
+
+kraken_planner *kraken_create(const char *configuration)
+{
+    // No exception crosses the C interface
+    try
+    {
+        std::unique_ptr<kraken_planner> planner(new kraken_planner());
+        if (configuration != nullptr)
+            planner->load(configuration);
+        return planner.release();
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+}
+
+void kraken_destroy(kraken_planner *planner)
+{
+    delete planner;
+}
+
+kraken_status kraken_load_configuration(kraken_planner *planner, const char *configuration)
+{
+    if (planner == nullptr || configuration == nullptr)
+        return KRAKEN_INVALID_ARGUMENT;
+    try
+    {
+        planner->load(configuration);
+        return KRAKEN_SUCCESS;
+    }
+    catch (const std::exception &)
+    {
+        return KRAKEN_INVALID_ARGUMENT;
+    }
+}
+
+kraken_status kraken_set_table(kraken_planner *planner, float min_x, float min_y, float max_x, float max_y)
+{
+    if (planner == nullptr || !(min_x < max_x && min_y < max_y))
+        return KRAKEN_INVALID_ARGUMENT;
+    try
+    {
+        planner->service.setNavmesh(std::make_shared<kraken::Navmesh>(kraken::Vector2D(min_x, min_y),
+                                                                      kraken::Vector2D(max_x, max_y)));
+        return KRAKEN_SUCCESS;
+    }
+    catch (const std::exception &)
+    {
+        return KRAKEN_INVALID_ARGUMENT;
+    }
+}
+
+int kraken_add_fixed_obstacle(kraken_planner *planner, const float *vertices, size_t vertex_count)
+{
+    if (planner == nullptr || vertices == nullptr || vertex_count < 3)
+        return -1;
+    try
+    {
+        std::vector<kraken::Vector2D> polygon;
+        for (size_t i = 0; i < vertex_count; i++)
+            polygon.emplace_back(vertices[2 * i], vertices[2 * i + 1]);
+        return planner->service.addFixedObstacle(polygon);
+    }
+    catch (const std::exception &)
+    {
+        return -1;
+    }
+}
+
+kraken_status kraken_remove_fixed_obstacle(kraken_planner *planner, int obstacle)
+{
+    if (planner == nullptr || obstacle < 0)
+        return KRAKEN_INVALID_ARGUMENT;
+    try
+    {
+        return planner->service.removeFixedObstacle(obstacle) ? KRAKEN_SUCCESS : KRAKEN_INVALID_ARGUMENT;
+    }
+    catch (const std::exception &)
+    {
+        return KRAKEN_INVALID_ARGUMENT;
+    }
+}
+
+kraken_status kraken_plan(kraken_planner *planner, const kraken_kinematic *start, const kraken_kinematic *goal,
+                          const kraken_circle *obstacles, size_t obstacle_count,
+                          kraken_itinerary_point *itinerary, size_t capacity, size_t *point_count)
+{
+    if (planner == nullptr || start == nullptr || goal == nullptr || (obstacles == nullptr && obstacle_count > 0)
+        || (itinerary == nullptr && capacity > 0) || point_count == nullptr)
+        return KRAKEN_INVALID_ARGUMENT;
+    *point_count = 0;
+
+    try
+    {
+        planner->obstacles->clear();
+        for (size_t i = 0; i < obstacle_count; i++)
+        {
+            const auto &circle = obstacles[i];
+            if (!planner->obstacles->add(kraken::CircularObstacle(kraken::Vector2D(circle.x, circle.y),
+                                                                 circle.radius)))
+                return KRAKEN_INVALID_ARGUMENT;
+        }
+
+        auto status = planner->context->plan(toKinematic(*start), toKinematic(*goal), *planner->obstacles,
+                                             planner->itinerary);
+        *point_count = planner->itinerary.size();
+        if (planner->itinerary.size() > capacity)
+            return KRAKEN_BUFFER_TOO_SMALL;
+        for (std::size_t i = 0; i < planner->itinerary.size(); i++)
+        {
+            const auto &point = planner->itinerary[i];
+            itinerary[i] = {point.getX(), point.getY(), point.getOrientation(), point.getCurvature(),
+                            point.getMaxSpeed(), point.getPossibleSpeed(), point.getGoingForward() ? 1 : 0,
+                            point.getStop() ? 1 : 0};
+        }
+        return static_cast<kraken_status>(status);
+    }
+    catch (const std::exception &)
+    {
+        return KRAKEN_INVALID_ARGUMENT;
+    }
+}
+
+const char *kraken_status_name(kraken_status status)
+{
+    switch (status)
+    {
+        case KRAKEN_SUCCESS:
+            return "Success";
+        case KRAKEN_NO_PATH:
+            return "NoPath";
+        case KRAKEN_TIMEOUT:
+            return "Timeout";
+        case KRAKEN_POOL_EXHAUSTED:
+            return "PoolExhausted";
+        case KRAKEN_CANCELLED:
+            return "Cancelled";
+        case KRAKEN_INVALID_ARGUMENT:
+            return "InvalidArgument";
+        case KRAKEN_BUFFER_TOO_SMALL:
+            return "BufferTooSmall";
+    }
+    return "Unknown";
+}
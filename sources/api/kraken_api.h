@@ -0,0 +1,119 @@
+#ifndef KRAKEN_API_H
+#define KRAKEN_API_H
+
+#include <stddef.h>
+
+/*
+ * C interface of the planner, stable across versions : the structures are only extended in a new API version.
+ * A kraken_planner owns its configuration, its tables and its buffers. Its functions must not be called concurrently,
+ * use one planner per thread.
+ * Units : positions in mm, orientations in rad, curvatures in m^-1, speeds in m/s.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define KRAKEN_API_VERSION 1
+
+typedef struct kraken_planner kraken_planner;
+
+typedef enum
+{
+    KRAKEN_SUCCESS = 0,
+    KRAKEN_NO_PATH = 1,
+    KRAKEN_TIMEOUT = 2,
+    KRAKEN_POOL_EXHAUSTED = 3,
+    KRAKEN_CANCELLED = 4,
+    KRAKEN_INVALID_ARGUMENT = 100,
+    KRAKEN_BUFFER_TOO_SMALL = 101
+} kraken_status;
+
+typedef struct
+{
+    float x;
+    float y;
+    float orientation;
+    float curvature;
+    int going_forward;
+} kraken_kinematic;
+
+typedef struct
+{
+    float x;
+    float y;
+    float radius;
+} kraken_circle;
+
+typedef struct
+{
+    float x;
+    float y;
+    float orientation;
+    float curvature;
+    float max_speed;
+    float possible_speed;
+    int going_forward;
+    int stop;
+} kraken_itinerary_point;
+
+int kraken_api_version(void);
+
+/**
+ * @param configuration content of an INI configuration, may be NULL for the default one
+ * @return NULL if the configuration is invalid
+ */
+kraken_planner *kraken_create(const char *configuration);
+void kraken_destroy(kraken_planner *planner);
+
+/**
+ * Loads a new configuration. The tables are rebuilt only if their parameters changed.
+ * @param planner
+ * @param configuration content of an INI configuration
+ * @return KRAKEN_SUCCESS or KRAKEN_INVALID_ARGUMENT
+ */
+kraken_status kraken_load_configuration(kraken_planner *planner, const char *configuration);
+
+/**
+ * Sets a navmesh covering the table, without fixed obstacle yet
+ * @return KRAKEN_SUCCESS or KRAKEN_INVALID_ARGUMENT
+ */
+kraken_status kraken_set_table(kraken_planner *planner, float min_x, float min_y, float max_x, float max_y);
+
+/**
+ * @param planner
+ * @param vertices x0, y0, x1, y1... of a convex polygon
+ * @param vertex_count
+ * @return the identifier of the obstacle, -1 on an error or without table
+ */
+int kraken_add_fixed_obstacle(kraken_planner *planner, const float *vertices, size_t vertex_count);
+
+/**
+ * @param planner
+ * @param obstacle identifier returned by kraken_add_fixed_obstacle
+ * @return KRAKEN_SUCCESS, or KRAKEN_INVALID_ARGUMENT if the identifier is unknown or already removed
+ */
+kraken_status kraken_remove_fixed_obstacle(kraken_planner *planner, int obstacle);
+
+/**
+ * @param planner
+ * @param start
+ * @param goal
+ * @param obstacles circular obstacles, may be NULL if obstacle_count is 0
+ * @param obstacle_count
+ * @param itinerary output buffer
+ * @param capacity size of the output buffer
+ * @param point_count output, the number of points of the itinerary, even if it does not fit in the buffer
+ * @return the status of the search, or KRAKEN_BUFFER_TOO_SMALL if the itinerary does not fit in the buffer
+ */
+kraken_status kraken_plan(kraken_planner *planner, const kraken_kinematic *start, const kraken_kinematic *goal,
+                          const kraken_circle *obstacles, size_t obstacle_count,
+                          kraken_itinerary_point *itinerary, size_t capacity, size_t *point_count);
+
+const char *kraken_status_name(kraken_status status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KRAKEN_API_H */
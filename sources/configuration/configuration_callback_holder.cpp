@@ -4,13 +4,22 @@ namespace kraken
 {
     void ConfigurationCallbackHolder::operator+=(const ConfigurationCallback callback)
     {
-        callbacks_.push_back(callback);
+        callbacks_.push_back([callback](ConfigurationHandler &configuration_handler,
+                                        const std::vector<ConfigKeys::ConfigKeys> &) {
+            callback(configuration_handler);
+        });
     }
 
-    void ConfigurationCallbackHolder::operator()(ConfigurationHandler &configuration_handler) const
+    void ConfigurationCallbackHolder::addChangeCallback(ConfigurationChangeCallback callback)
+    {
+        callbacks_.push_back(std::move(callback));
+    }
+
+    void ConfigurationCallbackHolder::operator()(ConfigurationHandler &configuration_handler,
+                                                 const std::vector<ConfigKeys::ConfigKeys> &changed_keys) const
     {
         for (const auto& iterator : callbacks_) {
-            (iterator)(configuration_handler);
+            (iterator)(configuration_handler, changed_keys);
         }
     }
 }
\ No newline at end of file
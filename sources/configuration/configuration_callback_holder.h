@@ -10,17 +10,28 @@ namespace kraken
 {
     class ConfigurationHandler;
 
+    namespace ConfigKeys {
+        enum class ConfigKeys;
+    }
+
     using ConfigurationCallback = std::function<void(ConfigurationHandler &)>;
 
+    //Also receives the keys of the module whose resolved value changed
+    using ConfigurationChangeCallback = std::function<void(ConfigurationHandler &,
+                                                           const std::vector<ConfigKeys::ConfigKeys> &)>;
+
     class ConfigurationCallbackHolder
     {
     public:
         void operator+=(const ConfigurationCallback callback);
 
-        void operator()(ConfigurationHandler &configuration_handler) const;
+        void addChangeCallback(ConfigurationChangeCallback callback);
+
+        void operator()(ConfigurationHandler &configuration_handler,
+                        const std::vector<ConfigKeys::ConfigKeys> &changed_keys) const;
 
     private:
-        std::vector<ConfigurationCallback> callbacks_;
+        std::vector<ConfigurationChangeCallback> callbacks_;
     };
 }
 
@@ -1,24 +1,28 @@
 #include "configuration_handler.h"
+#include "../instrumentation/trace_recorder.h"
 
 namespace kraken
 {
     ConfigurationHandler::ConfigurationHandler() :
         modules_(module_count)
     {
-
+        for (unsigned long key = 0; key < configuration_key_count; key++)
+            resolved_values_.push_back(resolve(static_cast<ConfigKey>(key)));
     }
 
 #if USE_FILESYSTEM
     void ConfigurationHandler::loadFromFile(const std::string& filename)
     {
+        ScopedTrace trace(PlanningPhase::ConfigReload);
         ini_reader_.loadFromFile(filename);
-        callCallbacks();
+        notifyChanges();
     }
 #endif
     void ConfigurationHandler::loadFromString(const std::string& fileContent)
     {
+        ScopedTrace trace(PlanningPhase::ConfigReload);
         ini_reader_.loadFromString(fileContent);
-        callCallbacks();
+        notifyChanges();
     }
 
     template<>
@@ -47,10 +51,22 @@ namespace kraken
         module_instance->registerCallback(std::move(callback));
     }
 
+    void ConfigurationHandler::registerChangeCallback(ConfigModule module_enum, ConfigurationChangeCallback callback)
+    {
+        auto module_instance = getModule(module_enum);
+        module_instance->registerChangeCallback(std::move(callback));
+    }
+
+    void ConfigurationHandler::registerUpdateCallback(ConfigurationChangeCallback callback)
+    {
+        update_callbacks_.addChangeCallback(std::move(callback));
+    }
+
     void ConfigurationHandler::changeModuleSection(ConfigModule module_enum, std::string new_section)
     {
         auto module_instance = getModule(module_enum);
-        module_instance->changeSection(*this, std::move(new_section));
+        if (module_instance->changeSection(std::move(new_section)))
+            notifyChanges();
     }
 
     void ConfigurationHandler::changeModuleSection(std::vector<ConfigModule>&& modules, std::string new_section)
@@ -85,11 +101,65 @@ namespace kraken
         return &modules_[static_cast<int>(module_enum)];
     }
 
-    void ConfigurationHandler::callCallbacks()
+    void ConfigurationHandler::notifyChanges()
+    {
+        if (update_depth_ > 0)
+            return;
+
+        std::vector<std::vector<ConfigKey>> changed_keys(module_count);
+        for (unsigned long i = 0; i < configuration_key_count; i++)
+        {
+            auto key = static_cast<ConfigKey>(i);
+            auto value = resolve(key);
+            if (value == resolved_values_[i])
+                continue;
+            resolved_values_[i] = std::move(value);
+            changed_keys[static_cast<int>(getModuleEnumFromKeyEnum(key))].push_back(key);
+        }
+
+        std::vector<ConfigKey> all_changed_keys;
+        for (unsigned long i = 0; i < module_count; i++)
+        {
+            if (changed_keys[i].empty())
+                continue;
+            modules_[i].callCallbacks(*this, changed_keys[i]);
+            all_changed_keys.insert(all_changed_keys.end(), changed_keys[i].begin(), changed_keys[i].end());
+        }
+
+        if (!all_changed_keys.empty())
+            update_callbacks_(*this, all_changed_keys);
+    }
+
+    ConfigurationHandler::ConfigurationParameter ConfigurationHandler::resolve(ConfigKey key)
     {
-        for(const auto& module_instance : modules_)
+        // Parsed with the type of the default value, so "1.0" and "1" are the same value
+        ConfigurationParameter value = default_values_[static_cast<int>(key)];
+        auto section_name = getSectionName(getModuleEnumFromKeyEnum(key));
+        auto key_name = getKeyName(key);
+        switch (value.type)
         {
-            module_instance.callCallbacks(*this);
+            case ConfigurationParameter::Type::Numeric:
+                value.numeric_value = ini_reader_.get<float>(section_name, key_name, value.numeric_value);
+                break;
+            case ConfigurationParameter::Type::Boolean:
+                value.boolean_value = ini_reader_.get<bool>(section_name, key_name, value.boolean_value);
+                break;
+            case ConfigurationParameter::Type::String:
+                value.string_value = ini_reader_.get<std::string>(section_name, key_name, value.string_value);
+                break;
         }
+        return value;
+    }
+
+    ScopedConfigurationUpdate::ScopedConfigurationUpdate(ConfigurationHandler &configuration_handler) :
+        configuration_handler_(configuration_handler)
+    {
+        configuration_handler_.update_depth_++;
+    }
+
+    ScopedConfigurationUpdate::~ScopedConfigurationUpdate()
+    {
+        if (--configuration_handler_.update_depth_ == 0)
+            configuration_handler_.notifyChanges();
     }
 }
\ No newline at end of file
@@ -51,6 +51,7 @@ namespace kraken {
             //Memory management parameters
             NodeMemoryPoolSize,
             ObstaclesMemoryPoolSize,
+            PlanCacheSize,
 
             //Tentacle parameters
             PrecisionTrace,
@@ -80,9 +81,12 @@ namespace kraken {
         //Structure holding all possible types of parameter value.
         //It should be an union, but it will require a bit more work because of the std::string
         struct ConfigurationParameter {
+            enum class Type { Numeric, Boolean, String };
+
             float numeric_value = 0;
             bool boolean_value = false;
             std::string string_value = {};
+            Type type = Type::Numeric;
 
             ConfigurationParameter() = default;
 
@@ -90,12 +94,20 @@ namespace kraken {
 
             explicit ConfigurationParameter(int value) { numeric_value = value; }
 
-            explicit ConfigurationParameter(bool value) { boolean_value = value; }
+            explicit ConfigurationParameter(bool value) { boolean_value = value; type = Type::Boolean; }
+
+            explicit ConfigurationParameter(const std::string& value) { string_value = value; type = Type::String; }
 
-            explicit ConfigurationParameter(const std::string& value) { string_value = value; }
+            bool operator==(const ConfigurationParameter& rhs) const
+            {
+                return numeric_value == rhs.numeric_value && boolean_value == rhs.boolean_value
+                       && string_value == rhs.string_value;
+            }
         };
 
     public:
+        static constexpr unsigned long module_count = (unsigned long) ConfigModule::Tentacle + 1;
+
         ConfigurationHandler();
 
 #if USE_FILESYSTEM
@@ -103,8 +115,23 @@ namespace kraken {
 #endif
         void loadFromString(const std::string& fileContent);
 
+        /**
+         * The callbacks of a module are called once per load or section change, and only if the resolved value of
+         * one of its keys changed
+         * @param module_enum
+         * @param callback
+         */
         void registerCallback(ConfigModule module_enum, ConfigurationCallback callback);
 
+        void registerChangeCallback(ConfigModule module_enum, ConfigurationChangeCallback callback);
+
+        /**
+         * The update callbacks are called once per load or section change, after the callbacks of the modules, with
+         * the changed keys of all the modules, and only if one of them changed
+         * @param callback
+         */
+        void registerUpdateCallback(ConfigurationChangeCallback callback);
+
         void changeModuleSection(ConfigModule module_enum, std::string new_section);
 
         void changeModuleSection(std::vector<ConfigModule> &&modules, std::string new_section);
@@ -123,24 +150,32 @@ namespace kraken {
             return get<T>(key, getModuleEnumFromKeyEnum(key));
         }
 
-    private:
+        std::string getSectionName(ConfigModule module_key);
+
         ConfigModule getModuleEnumFromKeyEnum(ConfigKey key) const noexcept;
 
-        std::string getSectionName(ConfigModule module_key);
+    private:
 
         std::string getKeyName(ConfigKey key);
 
         ConfigurationModule* getModule(ConfigModule module_enum);
 
-        void callCallbacks();
+        /**
+         * Compares the resolved values with the ones of the last notification, then calls the callbacks of the
+         * modules with changed keys, in the order of the modules, and the update callbacks. Deferred while a
+         * ScopedConfigurationUpdate exists.
+         */
+        void notifyChanges();
+
+        ConfigurationParameter resolve(ConfigKey key);
 
         template<class T>
         T getDefaultValue(ConfigKey key);
 
         INIReader ini_reader_;
         std::vector<ConfigurationModule> modules_;
+        ConfigurationCallbackHolder update_callbacks_;
         static constexpr unsigned long configuration_key_count = (unsigned long) ConfigKey::NbPoints + 1;
-        static constexpr unsigned long module_count = (unsigned long) ConfigModule::Tentacle + 1;
 
         //This array need to be initialized in the same order as the ConfigKey enum
         const ConfigurationParameter default_values_[configuration_key_count] = {
@@ -164,9 +199,10 @@ namespace kraken {
                 ConfigurationParameter{true},                       //EnableDebug
                 ConfigurationParameter{false},                      //FastAndDirty
                 ConfigurationParameter{false},                      //CheckNewObstacles
+                ConfigurationParameter{true},                       //AllowBackwardMotion
                 ConfigurationParameter{20000},                      //NodeMemoryPoolSize
                 ConfigurationParameter{50000},                      //ObstaclesMemoryPoolSize
-                ConfigurationParameter{true},                       //AllowBackwardMotion
+                ConfigurationParameter{32},                         //PlanCacheSize
                 ConfigurationParameter{0.02f},                      //PrecisionTrace
                 ConfigurationParameter{5}                          //NbPoints
         };
@@ -177,7 +213,8 @@ namespace kraken {
                 "NecessaryMargin", "PreferedMargin", "MarginBeforeCollision", "InitialMargin", "MaxCurvatureDerivative",
                 "MaxLateralAcceleration", "MaxLinearAcceleration", "DefaultMaxSpeed", "MinimalSpeed", "MaxCurvature",
                 "StopDuration", "SearchTimeout", "ThreadNumber", "EnableDebug", "FastAndDirty", "CheckNewObstacles",
-                "AllowBackwardMotion", "NodeMemoryPoolSize", "ObstaclesMemoryPoolSize", "PrecisionTrace", "NbPoints"
+                "AllowBackwardMotion", "NodeMemoryPoolSize", "ObstaclesMemoryPoolSize", "PlanCacheSize",
+                "PrecisionTrace", "NbPoints"
         };
 
         const std::pair<ConfigKey, ConfigModule> modules_limits[4] = {
@@ -186,6 +223,29 @@ namespace kraken {
             { ConfigKey::NodeMemoryPoolSize, ConfigModule::ResearchMechanical },
             { ConfigKey::PrecisionTrace, ConfigModule::Memory }
         };
+
+        //The values seen by the callbacks at the last notification
+        std::vector<ConfigurationParameter> resolved_values_;
+        int update_depth_ = 0;
+
+        friend class ScopedConfigurationUpdate;
+    };
+
+    /*
+     * Coalesces the loads and the section changes made during its lifetime : each affected module is notified once,
+     * with all its changed keys, when the last ScopedConfigurationUpdate is destroyed.
+     */
+    class ScopedConfigurationUpdate
+    {
+    public:
+        explicit ScopedConfigurationUpdate(ConfigurationHandler &configuration_handler);
+        ~ScopedConfigurationUpdate();
+
+        ScopedConfigurationUpdate(const ScopedConfigurationUpdate &) = delete;
+        ScopedConfigurationUpdate &operator=(const ScopedConfigurationUpdate &) = delete;
+
+    private:
+        ConfigurationHandler &configuration_handler_;
     };
 }
 #endif //CONFIGURATION_HANDLER_H
@@ -7,13 +7,17 @@ namespace kraken
         callbacks_holder_ += std::move(callback);
     }
 
-    void ConfigurationModule::changeSection(ConfigurationHandler &configuration_handler, std::string new_section)
+    void ConfigurationModule::registerChangeCallback(ConfigurationChangeCallback callback)
     {
-        if (new_section != current_section_)
-        {
-            current_section_ = new_section;
-            callCallbacks(configuration_handler);
-        }
+        callbacks_holder_.addChangeCallback(std::move(callback));
+    }
+
+    bool ConfigurationModule::changeSection(std::string new_section)
+    {
+        if (new_section == current_section_)
+            return false;
+        current_section_ = std::move(new_section);
+        return true;
     }
 
     std::string ConfigurationModule::getCurrentSection()
@@ -21,8 +25,9 @@ namespace kraken
         return current_section_;
     }
 
-    void ConfigurationModule::callCallbacks(ConfigurationHandler &configuration_handler) const
+    void ConfigurationModule::callCallbacks(ConfigurationHandler &configuration_handler,
+                                            const std::vector<ConfigKeys::ConfigKeys> &changed_keys) const
     {
-        callbacks_holder_(configuration_handler);
+        callbacks_holder_(configuration_handler, changed_keys);
     }
 }
\ No newline at end of file
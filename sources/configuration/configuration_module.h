@@ -15,11 +15,19 @@ namespace kraken
     public:
         void registerCallback(ConfigurationCallback callback);
 
-        void changeSection(ConfigurationHandler &configuration_handler, std::string new_section);
+        void registerChangeCallback(ConfigurationChangeCallback callback);
+
+        /**
+         * The callbacks are called by the ConfigurationHandler, if a value of the module changed
+         * @param new_section
+         * @return true if the section changed
+         */
+        bool changeSection(std::string new_section);
 
         std::string getCurrentSection();
 
-        void callCallbacks(ConfigurationHandler &configuration_handler) const;
+        void callCallbacks(ConfigurationHandler &configuration_handler,
+                           const std::vector<ConfigKeys::ConfigKeys> &changed_keys) const;
 
     private:
         ConfigurationCallbackHolder callbacks_holder_;
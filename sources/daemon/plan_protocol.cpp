@@ -0,0 +1,167 @@
+#include "plan_protocol.h"
+
+#include <cerrno>
+#include <limits>
+#include <stdexcept>
+#include <sys/socket.h>
+
+#include "../replay/binary_codec.h"
+
+namespace kraken
+{
+    namespace
+    {
+        constexpr std::size_t size_bytes = 4;
+
+        /*
+         * Leaves room for the size of the frame, written by finish, and starts the payload with the version
+         */
+        class FrameWriter : public BinaryWriter
+        {
+        public:
+            explicit FrameWriter(std::vector<std::uint8_t> &frame) : BinaryWriter(frame), frame_(frame)
+            {
+                frame_.assign(size_bytes, 0);
+                writeUint8(plan_protocol::version);
+            }
+
+            void finish()
+            {
+                auto size = static_cast<std::uint32_t>(frame_.size() - size_bytes);
+                for (std::size_t i = 0; i < size_bytes; i++)
+                    frame_[i] = static_cast<std::uint8_t>(size >> (8 * i));
+            }
+
+        private:
+            std::vector<std::uint8_t> &frame_;
+        };
+
+        class PayloadReader : public BinaryReader
+        {
+        public:
+            PayloadReader(const std::uint8_t *payload, std::size_t size) :
+                    BinaryReader(payload, size, "Malformed plan message. Unexpected end of message.")
+            {
+                if (readUint8() != plan_protocol::version)
+                    throw std::invalid_argument("Malformed plan message. Unsupported protocol version.");
+            }
+
+            void finish() const
+            {
+                if (!isAtEnd())
+                    throw std::invalid_argument("Malformed plan message. Unexpected bytes at the end.");
+            }
+        };
+
+        bool readAll(int socket, std::uint8_t *buffer, std::size_t size)
+        {
+            while (size > 0)
+            {
+                auto count = ::recv(socket, buffer, size, 0);
+                if (count < 0 && errno == EINTR)
+                    continue;
+                if (count <= 0)
+                    return false;
+                buffer += count;
+                size -= static_cast<std::size_t>(count);
+            }
+            return true;
+        }
+    }
+
+    void plan_protocol::encode(const PlanMessage &message, std::vector<std::uint8_t> &frame)
+    {
+        if (message.obstacles.size() > std::numeric_limits<std::uint16_t>::max())
+            throw std::invalid_argument("Too many obstacles to encode the plan message.");
+        FrameWriter encoder(frame);
+        encoder.writeUint32(message.id);
+        encoder.writeKinematic(message.start);
+        encoder.writeKinematic(message.goal);
+        encoder.writeUint16(static_cast<std::uint16_t>(message.obstacles.size()));
+        for (const auto &obstacle : message.obstacles)
+        {
+            encoder.writeFloat(obstacle.getPosition().getX());
+            encoder.writeFloat(obstacle.getPosition().getY());
+            encoder.writeFloat(obstacle.getRadius());
+        }
+        encoder.finish();
+    }
+
+    void plan_protocol::encode(const PlanReply &reply, std::vector<std::uint8_t> &frame)
+    {
+        FrameWriter encoder(frame);
+        encoder.writeUint32(reply.id);
+        encoder.writeUint8(static_cast<std::uint8_t>(reply.status));
+        encoder.writeUint32(reply.latency_us);
+        encoder.writeUint32(static_cast<std::uint32_t>(reply.itinerary.size()));
+        for (const auto &point : reply.itinerary)
+            encoder.writeItineraryPoint(point);
+        encoder.finish();
+    }
+
+    void plan_protocol::decode(const std::uint8_t *payload, std::size_t size, PlanMessage &message)
+    {
+        PayloadReader decoder(payload, size);
+        message.id = decoder.readUint32();
+        message.start = decoder.readKinematic();
+        message.goal = decoder.readKinematic();
+        auto obstacle_count = decoder.readUint16();
+        message.obstacles.clear();
+        for (std::uint16_t i = 0; i < obstacle_count; i++)
+        {
+            float x = decoder.readFloat();
+            float y = decoder.readFloat();
+            float radius = decoder.readFloat();
+            message.obstacles.emplace_back(Vector2D(x, y), radius);
+        }
+        decoder.finish();
+    }
+
+    void plan_protocol::decode(const std::uint8_t *payload, std::size_t size, PlanReply &reply)
+    {
+        PayloadReader decoder(payload, size);
+        reply.id = decoder.readUint32();
+        auto status = decoder.readUint8();
+        if (status > static_cast<std::uint8_t>(SearchStatus::Cancelled))
+            throw std::invalid_argument("Malformed plan reply. Unknown status.");
+        reply.status = static_cast<SearchStatus>(status);
+        reply.latency_us = decoder.readUint32();
+        auto point_count = decoder.readUint32();
+        reply.itinerary.clear();
+        for (std::uint32_t i = 0; i < point_count; i++)
+            reply.itinerary.push_back(decoder.readItineraryPoint());
+        decoder.finish();
+    }
+
+    bool plan_protocol::writeFrame(int socket, const std::vector<std::uint8_t> &frame)
+    {
+        const std::uint8_t *buffer = frame.data();
+        std::size_t size = frame.size();
+        while (size > 0)
+        {
+            // A client that disconnected must not kill the daemon with SIGPIPE
+            auto count = ::send(socket, buffer, size, MSG_NOSIGNAL);
+            if (count < 0 && errno == EINTR)
+                continue;
+            if (count <= 0)
+                return false;
+            buffer += count;
+            size -= static_cast<std::size_t>(count);
+        }
+        return true;
+    }
+
+    bool plan_protocol::readFrame(int socket, std::vector<std::uint8_t> &payload)
+    {
+        std::uint8_t size_buffer[size_bytes];
+        if (!readAll(socket, size_buffer, size_bytes))
+            return false;
+        std::uint32_t size = 0;
+        for (std::size_t i = 0; i < size_bytes; i++)
+            size |= static_cast<std::uint32_t>(size_buffer[i]) << (8 * i);
+        if (size > max_frame_size)
+            throw std::invalid_argument("Plan frame too large.");
+        payload.resize(size);
+        return readAll(socket, payload.data(), size);
+    }
+}
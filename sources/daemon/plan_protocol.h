@@ -0,0 +1,82 @@
+#ifndef KRAKEN_PLAN_PROTOCOL_H
+#define KRAKEN_PLAN_PROTOCOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../obstacles/circular_obstacle.h"
+#include "../planner/planning_context.h"
+#include "../struct/itinerary_point.h"
+#include "../struct/kinematic.h"
+
+namespace kraken
+{
+    struct PlanMessage
+    {
+        //Chosen by the client, sent back with the reply
+        std::uint32_t id = 0;
+        Kinematic start;
+        Kinematic goal;
+        std::vector<CircularObstacle> obstacles;
+    };
+
+    struct PlanReply
+    {
+        std::uint32_t id = 0;
+        SearchStatus status = SearchStatus::NoPath;
+        std::uint32_t latency_us = 0;
+        std::vector<ItineraryPoint> itinerary;
+    };
+
+    /*
+     * Binary protocol of the planning daemon. Every message is a frame : its payload size on 4 bytes, then the
+     * payload, starting with the protocol version byte. The values are encoded as in the request logs, see
+     * binary_codec.h : little-endian, floats bit for bit. A message has at most 65535 obstacles.
+     *   request : version, id (u32), start, goal (x, y, orientation, curvature as f32, flags u8),
+     *             obstacle count (u16), obstacles (x, y, radius as f32)
+     *   reply :   version, id (u32), status (u8), latency in us (u32), point count (u32),
+     *             points (x, y, orientation, curvature, max speed, possible speed as f32, flags u8)
+     * A request with more obstacles than ObstaclesMemoryPoolSize is not planned : its reply is PoolExhausted, without
+     * point.
+     */
+    namespace plan_protocol
+    {
+        constexpr std::uint8_t version = 1;
+        //Larger frames are rejected, whatever their content
+        constexpr std::uint32_t max_frame_size = 1 << 20;
+
+        /**
+         * Throws std::invalid_argument if the message has more than 65535 obstacles
+         * @param message
+         * @param frame output, cleared first
+         */
+        void encode(const PlanMessage &message, std::vector<std::uint8_t> &frame);
+        void encode(const PlanReply &reply, std::vector<std::uint8_t> &frame);
+
+        /**
+         * Throws std::invalid_argument if the payload is malformed
+         * @param payload the frame without its size
+         * @param size
+         * @param message
+         */
+        void decode(const std::uint8_t *payload, std::size_t size, PlanMessage &message);
+        void decode(const std::uint8_t *payload, std::size_t size, PlanReply &reply);
+
+        /**
+         * Writes a whole frame on a connected socket
+         * @return false on an error
+         */
+        bool writeFrame(int socket, const std::vector<std::uint8_t> &frame);
+
+        /**
+         * Reads the payload of the next frame, blocking. Throws std::invalid_argument if the frame is too large.
+         * @param socket
+         * @param payload output
+         * @return false at the end of the stream or on an error
+         */
+        bool readFrame(int socket, std::vector<std::uint8_t> &payload);
+    }
+}
+
+#endif //KRAKEN_PLAN_PROTOCOL_H
@@ -0,0 +1,154 @@
+#include "plan_server.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "plan_protocol.h"
+#include "../planner/planner_service.h"
+
+namespace kraken
+{
+    namespace
+    {
+        constexpr int poll_period_ms = 100;
+
+        /**
+         * @return false if nothing can be read before the poll period
+         */
+        bool waitReadable(int socket)
+        {
+            pollfd descriptor = {socket, POLLIN, 0};
+            return ::poll(&descriptor, 1, poll_period_ms) > 0;
+        }
+    }
+
+    PlanServer::PlanServer(PlannerService &service, const std::string &socket_path) :
+            service_(service), socket_path_(socket_path), listen_socket_(-1)
+    {
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        if (socket_path.empty() || socket_path.size() >= sizeof(address.sun_path))
+            throw std::runtime_error("Invalid socket path " + socket_path + ".");
+        std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size() + 1);
+
+        listen_socket_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listen_socket_ == -1)
+            throw std::runtime_error(std::string("Cannot create the socket: ") + std::strerror(errno));
+        ::unlink(socket_path.c_str());
+        if (::bind(listen_socket_, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == -1
+            || ::listen(listen_socket_, 8) == -1)
+        {
+            std::string error = std::strerror(errno);
+            ::close(listen_socket_);
+            throw std::runtime_error("Cannot listen on " + socket_path + ": " + error);
+        }
+    }
+
+    PlanServer::~PlanServer()
+    {
+        ::close(listen_socket_);
+        ::unlink(socket_path_.c_str());
+    }
+
+    void PlanServer::run(const std::atomic<bool> &stop)
+    {
+        while (!stop.load())
+        {
+            // The threads of the closed connections are joined as the server goes
+            for (auto it = connections_.begin(); it != connections_.end();)
+            {
+                if ((*it)->done.load())
+                {
+                    (*it)->thread.join();
+                    it = connections_.erase(it);
+                }
+                else
+                    ++it;
+            }
+
+            if (!waitReadable(listen_socket_))
+                continue;
+            int socket = ::accept(listen_socket_, nullptr, nullptr);
+            if (socket == -1)
+                continue;
+            connections_.emplace_back(new Connection());
+            auto &connection = *connections_.back();
+            connection.socket = socket;
+            connection.thread = std::thread(&PlanServer::serve, this, std::cref(stop), std::ref(connection));
+        }
+
+        // A thread blocked in the middle of a frame only returns once its socket is shut down
+        for (auto &connection : connections_)
+        {
+            std::lock_guard<std::mutex> lock(connection->socket_mutex);
+            if (connection->socket != -1)
+                ::shutdown(connection->socket, SHUT_RDWR);
+        }
+        for (auto &connection : connections_)
+            connection->thread.join();
+        connections_.clear();
+    }
+
+    void PlanServer::serve(const std::atomic<bool> &stop, Connection &connection)
+    {
+        int socket = connection.socket;
+        try
+        {
+            auto context = service_.createContext();
+            auto obstacles = service_.createObstacleSet();
+            std::vector<std::uint8_t> buffer;
+            PlanMessage message;
+            PlanReply reply;
+
+            while (!stop.load())
+            {
+                if (!waitReadable(socket))
+                    continue;
+                if (!plan_protocol::readFrame(socket, buffer))
+                    break;
+                plan_protocol::decode(buffer.data(), buffer.size(), message);
+
+                // A request with more obstacles than ObstaclesMemoryPoolSize is not planned : a path ignoring some of
+                // them could collide
+                auto begin = std::chrono::steady_clock::now();
+                reply.id = message.id;
+                obstacles.clear();
+                bool all_added = true;
+                for (const auto &obstacle : message.obstacles)
+                    all_added = all_added && obstacles.add(obstacle);
+                if (all_added)
+                    reply.status = context->plan(message.start, message.goal, obstacles, reply.itinerary);
+                else
+                {
+                    reply.status = SearchStatus::PoolExhausted;
+                    reply.itinerary.clear();
+                }
+                reply.latency_us = static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - begin).count());
+
+                plan_protocol::encode(reply, buffer);
+                if (!plan_protocol::writeFrame(socket, buffer))
+                    break;
+            }
+        }
+        catch (const std::exception &)
+        {
+            // A malformed frame desynchronizes the stream, and any other error only concerns this client : the
+            // connection is closed, the server keeps serving the others
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(connection.socket_mutex);
+            ::close(socket);
+            connection.socket = -1;
+        }
+        connection.done.store(true);
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef KRAKEN_PLAN_SERVER_H
+#define KRAKEN_PLAN_SERVER_H
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace kraken
+{
+    class PlannerService;
+
+    /*
+     * Serves planning requests on a Unix domain socket, with the protocol of plan_protocol.h.
+     * Every connection is served by its own thread and planning context : the requests of a connection are planned
+     * in order, and its replies come in the same order. The service stays loaded between the connections.
+     */
+    class PlanServer
+    {
+    public:
+        /**
+         * Listens on the socket, replacing the socket file left by a previous server.
+         * Throws std::runtime_error if the socket cannot be created.
+         * @param service
+         * @param socket_path
+         */
+        PlanServer(PlannerService &service, const std::string &socket_path);
+        ~PlanServer();
+
+        PlanServer(const PlanServer &) = delete;
+        PlanServer &operator=(const PlanServer &) = delete;
+
+        /**
+         * Accepts and serves the connections until stop is set, then shuts the open connections down and waits for
+         * their threads : a client blocked in the middle of a frame doesn't delay the stop.
+         * @param stop checked at least every 100 ms
+         */
+        void run(const std::atomic<bool> &stop);
+
+    private:
+        struct Connection
+        {
+            std::thread thread;
+            std::atomic<bool> done{false};
+            //Closed by the connection thread, shut down by run on stop : -1 once closed
+            std::mutex socket_mutex;
+            int socket = -1;
+        };
+
+        void serve(const std::atomic<bool> &stop, Connection &connection);
+
+        PlannerService &service_;
+        const std::string socket_path_;
+        int listen_socket_;
+        std::list<std::unique_ptr<Connection>> connections_;
+    };
+}
+
+#endif //KRAKEN_PLAN_SERVER_H
@@ -0,0 +1,111 @@
+#include "latency_histogram.h"
+
+namespace kraken
+{
+    LatencyHistogram::LatencyHistogram() : current_window_(0)
+    {
+        clear();
+    }
+
+    void LatencyHistogram::record(std::uint32_t duration_us)
+    {
+        auto window = current_window_.load(std::memory_order_relaxed);
+        counts_[window][bucketIndex(duration_us)].fetch_add(1, std::memory_order_relaxed);
+
+        auto current_max = max_[window].load(std::memory_order_relaxed);
+        while (duration_us > current_max
+               && !max_[window].compare_exchange_weak(current_max, duration_us, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void LatencyHistogram::rotate()
+    {
+        // The oldest window is cleared before being published, a concurrent record() still writing in the previous
+        // window is not lost.
+        auto next_window = (current_window_.load(std::memory_order_relaxed) + 1) % window_count;
+        for (auto &count : counts_[next_window])
+            count.store(0, std::memory_order_relaxed);
+        max_[next_window].store(0, std::memory_order_relaxed);
+        current_window_.store(next_window, std::memory_order_release);
+    }
+
+    void LatencyHistogram::clear()
+    {
+        for (unsigned int window = 0; window < window_count; window++)
+        {
+            for (auto &count : counts_[window])
+                count.store(0, std::memory_order_relaxed);
+            max_[window].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    LatencySummary LatencyHistogram::summarize() const
+    {
+        LatencySummary summary;
+        std::uint32_t merged[bucket_count] = {};
+        for (unsigned int window = 0; window < window_count; window++)
+        {
+            for (unsigned int i = 0; i < bucket_count; i++)
+                merged[i] += counts_[window][i].load(std::memory_order_relaxed);
+            auto window_max = max_[window].load(std::memory_order_relaxed);
+            if (window_max > summary.max_us)
+                summary.max_us = window_max;
+        }
+
+        for (auto count : merged)
+            summary.count += count;
+        if (summary.count == 0)
+            return summary;
+
+        auto p50_rank = (summary.count + 1) / 2;
+        auto p99_rank = summary.count - summary.count / 100;
+        std::uint32_t cumulated = 0;
+        for (unsigned int i = 0; i < bucket_count; i++)
+        {
+            if (merged[i] == 0)
+                continue;
+            cumulated += merged[i];
+            if (summary.p50_us == 0 && cumulated >= p50_rank)
+                summary.p50_us = bucketUpperBound(i);
+            if (cumulated >= p99_rank)
+            {
+                summary.p99_us = bucketUpperBound(i);
+                break;
+            }
+        }
+
+        // The bucket bound may overshoot the largest recorded value
+        if (summary.p50_us > summary.max_us)
+            summary.p50_us = summary.max_us;
+        if (summary.p99_us > summary.max_us)
+            summary.p99_us = summary.max_us;
+        return summary;
+    }
+
+    unsigned int LatencyHistogram::bucketIndex(std::uint32_t duration_us)
+    {
+        constexpr std::uint32_t sub_bucket_count = 1u << sub_bucket_bits;
+        if (duration_us < sub_bucket_count)
+            return duration_us;
+
+        unsigned int exponent = 31;
+        while (!(duration_us & (1u << exponent)))
+            exponent--;
+        auto sub_bucket = (duration_us >> (exponent - sub_bucket_bits)) & (sub_bucket_count - 1);
+        return ((exponent - sub_bucket_bits + 1) << sub_bucket_bits) + sub_bucket;
+    }
+
+    std::uint32_t LatencyHistogram::bucketUpperBound(unsigned int index)
+    {
+        constexpr std::uint32_t sub_bucket_count = 1u << sub_bucket_bits;
+        if (index < sub_bucket_count)
+            return index;
+
+        auto exponent = (index >> sub_bucket_bits) + sub_bucket_bits - 1;
+        auto sub_bucket = index & (sub_bucket_count - 1);
+        auto lower_bound = (std::uint64_t{1} << exponent) + (std::uint64_t{sub_bucket} << (exponent - sub_bucket_bits));
+        auto upper_bound = lower_bound + (std::uint64_t{1} << (exponent - sub_bucket_bits)) - 1;
+        return upper_bound > UINT32_MAX ? UINT32_MAX : static_cast<std::uint32_t>(upper_bound);
+    }
+}
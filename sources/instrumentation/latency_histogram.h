@@ -0,0 +1,48 @@
+#ifndef KRAKEN_LATENCY_HISTOGRAM_H
+#define KRAKEN_LATENCY_HISTOGRAM_H
+
+#include <atomic>
+#include <cstdint>
+
+namespace kraken
+{
+    struct LatencySummary
+    {
+        std::uint32_t count = 0;
+        std::uint32_t p50_us = 0;
+        std::uint32_t p99_us = 0;
+        std::uint32_t max_us = 0;
+    };
+
+    /*
+     * Rolling histogram of durations, in μs.
+     * Buckets are log-linear (8 linear sub-buckets per power of two), so the relative error of a percentile is
+     * bounded by 12.5%. The histogram keeps window_count generations: record() only touches the current one,
+     * rotate() drops the oldest one. Every operation is lock-free.
+     */
+    class LatencyHistogram
+    {
+    public:
+        static constexpr unsigned int sub_bucket_bits = 3;
+        static constexpr unsigned int bucket_count = 32 << sub_bucket_bits;
+        static constexpr unsigned int window_count = 4;
+
+        LatencyHistogram();
+
+        void record(std::uint32_t duration_us);
+        void rotate();
+        void clear();
+
+        LatencySummary summarize() const;
+
+    private:
+        static unsigned int bucketIndex(std::uint32_t duration_us);
+        static std::uint32_t bucketUpperBound(unsigned int index);
+
+        std::atomic<std::uint32_t> counts_[window_count][bucket_count];
+        std::atomic<std::uint32_t> max_[window_count];
+        std::atomic<unsigned int> current_window_;
+    };
+}
+
+#endif //KRAKEN_LATENCY_HISTOGRAM_H
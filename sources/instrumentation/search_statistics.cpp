@@ -0,0 +1,48 @@
+#include "search_statistics.h"
+
+namespace kraken
+{
+    namespace
+    {
+        const char *const search_counter_names[search_counter_count] = {
+                "NodesExpanded", "NodesGenerated", "CollisionChecks", "CacheHits", "CacheMisses", "NodesPruned"
+        };
+
+        const char *const planning_phase_names[planning_phase_count] = {
+                "ConfigReload", "NavmeshLoad", "HeuristicBuild", "Search", "SpeedProfile"
+        };
+    }
+
+    const char *getSearchCounterName(SearchCounter counter)
+    {
+        return search_counter_names[static_cast<unsigned int>(counter)];
+    }
+
+    const char *getPlanningPhaseName(PlanningPhase phase)
+    {
+        return planning_phase_names[static_cast<unsigned int>(phase)];
+    }
+
+    void SearchStatistics::reset()
+    {
+        *this = SearchStatistics();
+    }
+
+    SearchStatistics &search_statistics::local()
+    {
+        static thread_local SearchStatistics statistics;
+        return statistics;
+    }
+
+    ScopedPhaseTimer::ScopedPhaseTimer(PlanningPhase phase) : phase_(phase), start_(std::chrono::steady_clock::now())
+    {
+
+    }
+
+    ScopedPhaseTimer::~ScopedPhaseTimer()
+    {
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_);
+        search_statistics::local().phase_durations_us[static_cast<unsigned int>(phase_)] +=
+                static_cast<std::uint32_t>(duration.count());
+    }
+}
@@ -0,0 +1,105 @@
+#ifndef KRAKEN_SEARCH_STATISTICS_H
+#define KRAKEN_SEARCH_STATISTICS_H
+
+#include <chrono>
+#include <cstdint>
+
+namespace kraken
+{
+    namespace SearchCounters {
+        enum class SearchCounters {
+            NodesExpanded = 0,
+            NodesGenerated,
+            CollisionChecks,
+            CacheHits,
+            CacheMisses,
+            NodesPruned,
+            CounterCount
+        };
+    }
+    using SearchCounter = SearchCounters::SearchCounters;
+
+    namespace PlanningPhases {
+        enum class PlanningPhases {
+            ConfigReload = 0,
+            NavmeshLoad,
+            HeuristicBuild,
+            Search,
+            SpeedProfile,
+            PhaseCount
+        };
+    }
+    using PlanningPhase = PlanningPhases::PlanningPhases;
+
+    constexpr unsigned int search_counter_count = static_cast<unsigned int>(SearchCounter::CounterCount);
+    constexpr unsigned int planning_phase_count = static_cast<unsigned int>(PlanningPhase::PhaseCount);
+
+    const char *getSearchCounterName(SearchCounter counter);
+    const char *getPlanningPhaseName(PlanningPhase phase);
+
+    /*
+     * Statistics of a single search.
+     * The instance returned by search_statistics::local() belongs to the calling thread, so the hot loop can
+     * update it without any synchronization. It is published to a StatisticsRegistry at the end of the search.
+     */
+    struct SearchStatistics
+    {
+        std::uint32_t counters[search_counter_count] = {};
+        std::uint32_t pool_high_water_mark = 0;
+        std::uint32_t obstacle_high_water_mark = 0;
+        std::uint32_t phase_durations_us[planning_phase_count] = {};
+
+        void reset();
+
+        void increment(SearchCounter counter, std::uint32_t amount = 1)
+        {
+            counters[static_cast<unsigned int>(counter)] += amount;
+        }
+
+        void updatePoolUsage(std::uint32_t used_nodes)
+        {
+            if (used_nodes > pool_high_water_mark)
+                pool_high_water_mark = used_nodes;
+        }
+
+        void updateObstacleUsage(std::uint32_t obstacle_count)
+        {
+            if (obstacle_count > obstacle_high_water_mark)
+                obstacle_high_water_mark = obstacle_count;
+        }
+
+        std::uint32_t get(SearchCounter counter) const
+        {
+            return counters[static_cast<unsigned int>(counter)];
+        }
+
+        std::uint32_t getPhaseDuration(PlanningPhase phase) const
+        {
+            return phase_durations_us[static_cast<unsigned int>(phase)];
+        }
+    };
+
+    namespace search_statistics
+    {
+        SearchStatistics &local();
+    }
+
+    /*
+     * Adds the time spent in its scope to the duration of a phase in the thread-local statistics.
+     */
+    class ScopedPhaseTimer
+    {
+    public:
+        explicit ScopedPhaseTimer(PlanningPhase phase);
+        ~ScopedPhaseTimer();
+
+        ScopedPhaseTimer(const ScopedPhaseTimer &) = delete;
+        ScopedPhaseTimer &operator=(const ScopedPhaseTimer &) = delete;
+
+    private:
+        const PlanningPhase phase_;
+        const std::chrono::steady_clock::time_point start_;
+    };
+}
+
+#endif //KRAKEN_SEARCH_STATISTICS_H
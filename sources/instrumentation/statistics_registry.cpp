@@ -0,0 +1,134 @@
+#include "statistics_registry.h"
+#include "../configuration/configuration_handler.h"
+
+namespace kraken
+{
+    namespace
+    {
+        std::int64_t nowInMilliseconds()
+        {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        std::ostream &operator<<(std::ostream &strm, const LatencySummary &summary)
+        {
+            return strm << "n=" << summary.count << " p50=" << summary.p50_us << "us p99=" << summary.p99_us
+                        << "us max=" << summary.max_us << "us";
+        }
+    }
+
+    StatisticsRegistry::StatisticsRegistry(std::ostream &dump_stream, std::chrono::milliseconds dump_period) :
+            dump_stream_(dump_stream), dump_period_(dump_period), debug_enabled_(false),
+            last_dump_(nowInMilliseconds()), search_count_(0), pool_high_water_mark_(0),
+            obstacle_high_water_mark_(0)
+    {
+        for (auto &counter : counters_)
+            counter.store(0, std::memory_order_relaxed);
+    }
+
+    void StatisticsRegistry::attach(ConfigurationHandler &configuration_handler)
+    {
+        setDebugEnabled(configuration_handler.get<bool>(ConfigKey::EnableDebug));
+        configuration_handler.registerCallback(ConfigModule::ResearchMechanical, [this](ConfigurationHandler &ch) {
+            setDebugEnabled(ch.get<bool>(ConfigKey::EnableDebug));
+        });
+    }
+
+    void StatisticsRegistry::publish(const SearchStatistics &statistics, std::uint32_t search_latency_us)
+    {
+        search_count_.fetch_add(1, std::memory_order_relaxed);
+        for (unsigned int i = 0; i < search_counter_count; i++)
+            counters_[i].fetch_add(statistics.counters[i], std::memory_order_relaxed);
+
+        updateMaximum(pool_high_water_mark_, statistics.pool_high_water_mark);
+        updateMaximum(obstacle_high_water_mark_, statistics.obstacle_high_water_mark);
+
+        search_latency_.record(search_latency_us);
+        for (unsigned int i = 0; i < planning_phase_count; i++)
+        {
+            if (statistics.phase_durations_us[i] != 0)
+                phase_latency_[i].record(statistics.phase_durations_us[i]);
+        }
+
+        if (debug_enabled_.load(std::memory_order_relaxed))
+            dumpIfNeeded();
+    }
+
+    void StatisticsRegistry::recordPhase(PlanningPhase phase, std::uint32_t duration_us)
+    {
+        phase_latency_[static_cast<unsigned int>(phase)].record(duration_us);
+    }
+
+    StatisticsSnapshot StatisticsRegistry::poll() const
+    {
+        StatisticsSnapshot snapshot;
+        snapshot.search_count = search_count_.load(std::memory_order_relaxed);
+        for (unsigned int i = 0; i < search_counter_count; i++)
+            snapshot.counters[i] = counters_[i].load(std::memory_order_relaxed);
+        snapshot.pool_high_water_mark = pool_high_water_mark_.load(std::memory_order_relaxed);
+        snapshot.obstacle_high_water_mark = obstacle_high_water_mark_.load(std::memory_order_relaxed);
+        snapshot.search_latency = search_latency_.summarize();
+        for (unsigned int i = 0; i < planning_phase_count; i++)
+            snapshot.phase_latency[i] = phase_latency_[i].summarize();
+        return snapshot;
+    }
+
+    void StatisticsRegistry::rotate()
+    {
+        search_latency_.rotate();
+        for (auto &histogram : phase_latency_)
+            histogram.rotate();
+    }
+
+    void StatisticsRegistry::dump(std::ostream &strm) const
+    {
+        strm << poll();
+    }
+
+    void StatisticsRegistry::setDebugEnabled(bool enabled)
+    {
+        debug_enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    void StatisticsRegistry::updateMaximum(std::atomic<std::uint32_t> &maximum, std::uint32_t value)
+    {
+        auto current = maximum.load(std::memory_order_relaxed);
+        while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void StatisticsRegistry::dumpIfNeeded()
+    {
+        auto now = nowInMilliseconds();
+        auto last_dump = last_dump_.load(std::memory_order_relaxed);
+        if (now - last_dump < dump_period_.count())
+            return;
+
+        // Only the thread winning the exchange writes the dump
+        if (last_dump_.compare_exchange_strong(last_dump, now, std::memory_order_relaxed))
+        {
+            dump(dump_stream_);
+            rotate();
+        }
+    }
+
+    std::ostream &operator<<(std::ostream &strm, const StatisticsSnapshot &snapshot)
+    {
+        strm << "Kraken statistics: " << snapshot.search_count << " searches, pool high-water mark "
+             << snapshot.pool_high_water_mark << " nodes, " << snapshot.obstacle_high_water_mark << " obstacles"
+             << std::endl;
+        for (unsigned int i = 0; i < search_counter_count; i++)
+            strm << "  " << getSearchCounterName(static_cast<SearchCounter>(i)) << ": " << snapshot.counters[i]
+                 << std::endl;
+        strm << "  Latency: " << snapshot.search_latency << std::endl;
+        for (unsigned int i = 0; i < planning_phase_count; i++)
+        {
+            if (snapshot.phase_latency[i].count != 0)
+                strm << "  " << getPlanningPhaseName(static_cast<PlanningPhase>(i)) << ": "
+                     << snapshot.phase_latency[i] << std::endl;
+        }
+        return strm;
+    }
+}
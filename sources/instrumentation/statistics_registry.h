@@ -0,0 +1,76 @@
+#ifndef KRAKEN_STATISTICS_REGISTRY_H
+#define KRAKEN_STATISTICS_REGISTRY_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+#include "latency_histogram.h"
+#include "search_statistics.h"
+
+namespace kraken
+{
+    class ConfigurationHandler;
+
+    struct StatisticsSnapshot
+    {
+        std::uint64_t search_count = 0;
+        std::uint64_t counters[search_counter_count] = {};
+        std::uint32_t pool_high_water_mark = 0;
+        std::uint32_t obstacle_high_water_mark = 0;
+        LatencySummary search_latency;
+        LatencySummary phase_latency[planning_phase_count];
+    };
+
+    /*
+     * Aggregates the statistics published by every search, whatever the thread it ran on.
+     * poll() can be called at any time. When EnableDebug is set, a summary is also written to the dump stream at most
+     * once per dump period; the histograms are rotated at the same time so the percentiles stay recent.
+     */
+    class StatisticsRegistry
+    {
+    public:
+        explicit StatisticsRegistry(std::ostream &dump_stream,
+                                    std::chrono::milliseconds dump_period = std::chrono::milliseconds(5000));
+
+        void attach(ConfigurationHandler &configuration_handler);
+
+        void publish(const SearchStatistics &statistics, std::uint32_t search_latency_us);
+
+        /**
+         * Records the duration of a phase run outside of a search, e.g. a navmesh update
+         * @param phase
+         * @param duration_us
+         */
+        void recordPhase(PlanningPhase phase, std::uint32_t duration_us);
+
+        StatisticsSnapshot poll() const;
+
+        void rotate();
+        void dump(std::ostream &strm) const;
+
+        void setDebugEnabled(bool enabled);
+
+    private:
+        static void updateMaximum(std::atomic<std::uint32_t> &maximum, std::uint32_t value);
+
+        void dumpIfNeeded();
+
+        std::ostream &dump_stream_;
+        const std::chrono::milliseconds dump_period_;
+
+        std::atomic<bool> debug_enabled_;
+        std::atomic<std::int64_t> last_dump_;
+        std::atomic<std::uint64_t> search_count_;
+        std::atomic<std::uint64_t> counters_[search_counter_count];
+        std::atomic<std::uint32_t> pool_high_water_mark_;
+        std::atomic<std::uint32_t> obstacle_high_water_mark_;
+        LatencyHistogram search_latency_;
+        LatencyHistogram phase_latency_[planning_phase_count];
+    };
+
+    std::ostream &operator<<(std::ostream &strm, const StatisticsSnapshot &snapshot);
+}
+
+#endif //KRAKEN_STATISTICS_REGISTRY_H
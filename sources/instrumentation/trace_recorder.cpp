@@ -0,0 +1,132 @@
+#include "trace_recorder.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "../configuration/configuration_handler.h"
+
+namespace kraken
+{
+    namespace
+    {
+        /*
+         * Seqlock : sequence is odd while the owning thread writes the slot, then 2 * (index + 1) for the event index
+         * it holds. A reader keeps the event only if the sequence is the expected one before and after its copy.
+         */
+        struct TraceSlot
+        {
+            std::atomic<std::uint64_t> sequence{0};
+            std::atomic<std::uint8_t> phase{0};
+            std::atomic<std::int64_t> begin_us{0};
+            std::atomic<std::uint32_t> duration_us{0};
+        };
+
+        struct ThreadTraceBuffer
+        {
+            explicit ThreadTraceBuffer(unsigned int id) : thread_id(id), written(0), first_visible(0)
+            {
+
+            }
+
+            const unsigned int thread_id;
+            //Only written by the owning thread
+            std::atomic<std::uint64_t> written;
+            //Set by clear : the events before it are not exported
+            std::atomic<std::uint64_t> first_visible;
+            TraceSlot events[TraceRecorder::buffer_capacity];
+        };
+
+        std::mutex buffers_mutex;
+        std::vector<std::unique_ptr<ThreadTraceBuffer>> buffers;
+
+        ThreadTraceBuffer &localBuffer()
+        {
+            static thread_local ThreadTraceBuffer *buffer = nullptr;
+            if (buffer == nullptr)
+            {
+                std::lock_guard<std::mutex> lock(buffers_mutex);
+                buffers.emplace_back(new ThreadTraceBuffer(static_cast<unsigned int>(buffers.size()) + 1));
+                buffer = buffers.back().get();
+            }
+            return *buffer;
+        }
+    }
+
+    std::atomic<bool> TraceRecorder::enabled_(false);
+
+    void TraceRecorder::setEnabled(bool enabled)
+    {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    void TraceRecorder::attach(ConfigurationHandler &configuration_handler)
+    {
+        setEnabled(configuration_handler.get<bool>(ConfigKey::EnableDebug));
+        configuration_handler.registerCallback(ConfigModule::ResearchMechanical, [](ConfigurationHandler &ch) {
+            setEnabled(ch.get<bool>(ConfigKey::EnableDebug));
+        });
+    }
+
+    std::int64_t TraceRecorder::now()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void TraceRecorder::record(PlanningPhase phase, std::int64_t begin_us, std::int64_t end_us)
+    {
+        auto &buffer = localBuffer();
+        auto index = buffer.written.load(std::memory_order_relaxed);
+        auto &slot = buffer.events[index % buffer_capacity];
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.phase.store(static_cast<std::uint8_t>(phase), std::memory_order_relaxed);
+        slot.begin_us.store(begin_us, std::memory_order_relaxed);
+        slot.duration_us.store(static_cast<std::uint32_t>(end_us - begin_us), std::memory_order_relaxed);
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+        buffer.written.store(index + 1, std::memory_order_release);
+    }
+
+    void TraceRecorder::writeChromeTrace(std::ostream &strm)
+    {
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+        strm << "{\"traceEvents\":[";
+        auto first = true;
+        for (const auto &buffer : buffers)
+        {
+            auto written = buffer->written.load(std::memory_order_acquire);
+            auto oldest = std::max(buffer->first_visible.load(std::memory_order_relaxed),
+                                   written > buffer_capacity ? written - buffer_capacity : 0);
+            for (auto index = oldest; index < written; index++)
+            {
+                // The owning thread may be overwriting the slot once its ring wrapped : a torn copy is skipped
+                const auto &slot = buffer->events[index % buffer_capacity];
+                auto sequence = slot.sequence.load(std::memory_order_acquire);
+                if (sequence != 2 * index + 2)
+                    continue;
+                TraceEvent event = {static_cast<PlanningPhase>(slot.phase.load(std::memory_order_relaxed)),
+                                    slot.begin_us.load(std::memory_order_relaxed),
+                                    slot.duration_us.load(std::memory_order_relaxed)};
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) != sequence)
+                    continue;
+
+                strm << (first ? "" : ",") << "\n{\"name\":\"" << getPlanningPhaseName(event.phase)
+                     << "\",\"cat\":\"kraken\",\"ph\":\"X\",\"ts\":" << event.begin_us << ",\"dur\":"
+                     << event.duration_us << ",\"pid\":1,\"tid\":" << buffer->thread_id << "}";
+                first = false;
+            }
+        }
+        strm << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+    }
+
+    void TraceRecorder::clear()
+    {
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+        // The counter of a buffer belongs to its thread : the cleared events are only hidden from the exports
+        for (const auto &buffer : buffers)
+            buffer->first_visible.store(buffer->written.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,82 @@
+#ifndef KRAKEN_TRACE_RECORDER_H
+#define KRAKEN_TRACE_RECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+#include "search_statistics.h"
+
+namespace kraken
+{
+    class ConfigurationHandler;
+
+    struct TraceEvent
+    {
+        PlanningPhase phase;
+        std::int64_t begin_us;
+        std::uint32_t duration_us;
+    };
+
+    /*
+     * Records timed planning phases in one ring buffer per thread and exports them in the Chrome trace JSON format
+     * (chrome://tracing, ui.perfetto.dev).
+     * Recording is lock-free: a thread only takes a lock the first time it records an event, to register its buffer.
+     * The buffers outlive their threads so that a dump shows the whole process.
+     */
+    class TraceRecorder
+    {
+    public:
+        static constexpr unsigned int buffer_capacity = 4096;
+
+        static bool isEnabled()
+        {
+            return enabled_.load(std::memory_order_relaxed);
+        }
+
+        static void setEnabled(bool enabled);
+        static void attach(ConfigurationHandler &configuration_handler);
+
+        static std::int64_t now();
+        static void record(PlanningPhase phase, std::int64_t begin_us, std::int64_t end_us);
+
+        /**
+         * Events being recorded or overwritten during the export may be missing from it, but are never torn.
+         * @param strm
+         */
+        static void writeChromeTrace(std::ostream &strm);
+        static void clear();
+
+    private:
+        static std::atomic<bool> enabled_;
+    };
+
+    /*
+     * When tracing is disabled, the only cost of a ScopedTrace is the test of the flag.
+     */
+    class ScopedTrace
+    {
+    public:
+        explicit ScopedTrace(PlanningPhase phase) :
+                phase_(phase), begin_us_(TraceRecorder::isEnabled() ? TraceRecorder::now() : -1)
+        {
+
+        }
+
+        ~ScopedTrace()
+        {
+            if (begin_us_ >= 0)
+                TraceRecorder::record(phase_, begin_us_, TraceRecorder::now());
+        }
+
+        ScopedTrace(const ScopedTrace &) = delete;
+        ScopedTrace &operator=(const ScopedTrace &) = delete;
+
+    private:
+        const PlanningPhase phase_;
+        const std::int64_t begin_us_;
+    };
+}
+
+#endif //KRAKEN_TRACE_RECORDER_H
@@ -0,0 +1,704 @@
+#include "navmesh.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../instrumentation/trace_recorder.h"
+
+namespace kraken
+{
+    namespace
+    {
+        //The vertices closer than that to the border or to another vertex are not inserted, in mm
+        constexpr float vertex_tolerance = 1.f;
+    }
+
+    Navmesh::Navmesh(const Vector2D &bottom_left, const Vector2D &top_right, float cell_size) :
+            bottom_left_(bottom_left), top_right_(top_right), max_edge_length_(cell_size),
+            locator_(bottom_left, top_right, cell_size), last_triangle_(0), visit_stamp_(0)
+    {
+        ScopedTrace trace(PlanningPhase::NavmeshLoad);
+        vertices_.push_back(bottom_left);
+        vertices_.emplace_back(top_right.getX(), bottom_left.getY());
+        vertices_.push_back(top_right);
+        vertices_.emplace_back(bottom_left.getX(), top_right.getY());
+        vertex_triangles_ = {0, 0, 0, 1};
+        // The corners are never removed
+        vertex_references_.assign(4, 1);
+        triangles_.push_back({{0, 1, 2}, {-1, -1, 1}, {false, false, false}, false, true});
+        triangles_.push_back({{0, 2, 3}, {0, -1, -1}, {false, false, false}, false, true});
+        locator_.build(*this);
+    }
+
+    int Navmesh::addPolygon(const std::vector<Vector2D> &polygon)
+    {
+        if (polygon.size() < 3)
+            return -1;
+        ScopedTrace trace(PlanningPhase::NavmeshLoad);
+
+        auto identifier = static_cast<int>(std::find_if(polygons_.begin(), polygons_.end(), [](const Polygon &p) {
+            return !p.alive;
+        }) - polygons_.begin());
+        if (identifier == static_cast<int>(polygons_.size()))
+            polygons_.emplace_back();
+        auto &added = polygons_[identifier];
+        added.outline = polygon;
+        added.vertices.clear();
+        added.alive = true;
+
+        float doubled_area = 0;
+        float min_x = polygon[0].getX(), min_y = polygon[0].getY(), max_x = min_x, max_y = min_y;
+        for (std::size_t i = 0; i < polygon.size(); i++)
+        {
+            const auto &from = polygon[i];
+            const auto &to = polygon[(i + 1) % polygon.size()];
+            doubled_area += from.getX() * to.getY() - to.getX() * from.getY();
+            min_x = std::min(min_x, from.getX());
+            min_y = std::min(min_y, from.getY());
+            max_x = std::max(max_x, from.getX());
+            max_y = std::max(max_y, from.getY());
+        }
+        if (doubled_area < 0)
+            std::reverse(added.outline.begin(), added.outline.end());
+        added.bottom_left = Vector2D(min_x, min_y);
+        added.top_right = Vector2D(max_x, max_y);
+
+        added.edges.clear();
+
+        touched_.clear();
+        outline_vertices_.clear();
+        for (std::size_t i = 0; i < polygon.size(); i++)
+        {
+            const auto &from = polygon[i];
+            const auto &to = polygon[(i + 1) % polygon.size()];
+            auto pieces = std::max(1, static_cast<int>(std::ceil(from.distance(to) / max_edge_length_)));
+            for (int piece = 0; piece < pieces; piece++)
+            {
+                Vector2D vertex = to - from;
+                vertex *= static_cast<float>(piece) / pieces;
+                int inserted = insertVertex(vertex + from);
+                outline_vertices_.push_back(inserted);
+                if (inserted == -1)
+                    continue;
+                vertex_references_[inserted]++;
+                added.vertices.push_back(inserted);
+            }
+        }
+
+        // The pieces outside the table are not constrained, the border of the table closes the polygon
+        for (std::size_t i = 0; i < outline_vertices_.size(); i++)
+        {
+            int from = outline_vertices_[i];
+            int to = outline_vertices_[(i + 1) % outline_vertices_.size()];
+            if (from != -1 && to != -1)
+                insertConstraint(from, to, added);
+        }
+
+        updateBlocked(added.outline);
+        updateLocator();
+        return identifier;
+    }
+
+    void Navmesh::removePolygon(int polygon)
+    {
+        if (!hasPolygon(polygon))
+            return;
+        auto &removed = polygons_[polygon];
+        ScopedTrace trace(PlanningPhase::NavmeshLoad);
+        removed.alive = false;
+
+        // The edges shared with another polygon stay constrained
+        touched_.clear();
+        edge_stack_.clear();
+        for (const auto &edge : removed.edges)
+        {
+            int triangle, index;
+            if (isConstraint(edge.first, edge.second) || !findEdge(edge.first, edge.second, triangle, index))
+                continue;
+            setConstrained(triangle, index, false);
+            edge_stack_.push_back(edge);
+        }
+
+        for (int vertex : removed.vertices)
+            if (--vertex_references_[vertex] == 0)
+                removeVertex(vertex);
+        legalizeEdges();
+
+        updateBlocked(removed.outline);
+        updateLocator();
+    }
+
+    bool Navmesh::hasPolygon(int polygon) const
+    {
+        return polygon >= 0 && polygon < static_cast<int>(polygons_.size()) && polygons_[polygon].alive;
+    }
+
+    std::vector<Vector2D> Navmesh::getPolygon(const CircularObstacle &obstacle, int vertex_count)
+    {
+        std::vector<Vector2D> polygon;
+        float radius = obstacle.getRadius() / std::cos(static_cast<float>(M_PI) / vertex_count);
+        for (int i = 0; i < vertex_count; i++)
+            polygon.push_back(obstacle.getPosition()
+                              + Vector2D::fromPolar(radius, 2 * static_cast<float>(M_PI) * i / vertex_count));
+        return polygon;
+    }
+
+    int Navmesh::locate(const Vector2D &point, int hint) const
+    {
+        return locator_.locate(*this, point, hint);
+    }
+
+    bool Navmesh::contains(int triangle, const Vector2D &point) const
+    {
+        const auto &vertices = triangles_[triangle].vertices;
+        for (int i = 0; i < 3; i++)
+            if (Vector2D::orientation(vertices_[vertices[i]], vertices_[vertices[(i + 1) % 3]], point) < 0)
+                return false;
+        return true;
+    }
+
+    Vector2D Navmesh::getCentroid(int triangle) const
+    {
+        const auto &vertices = triangles_[triangle].vertices;
+        Vector2D centroid = vertices_[vertices[0]] + vertices_[vertices[1]] + vertices_[vertices[2]];
+        centroid *= 1.f / 3;
+        return centroid;
+    }
+
+    const NavmeshTriangle &Navmesh::getTriangle(int triangle) const
+    {
+        return triangles_[triangle];
+    }
+
+    const Vector2D &Navmesh::getVertex(int vertex) const
+    {
+        return vertices_[vertex];
+    }
+
+    std::size_t Navmesh::getTriangleCount() const
+    {
+        return triangles_.size();
+    }
+
+    std::size_t Navmesh::getVertexCount() const
+    {
+        return vertices_.size();
+    }
+
+    const Vector2D &Navmesh::getBottomLeft() const
+    {
+        return bottom_left_;
+    }
+
+    const Vector2D &Navmesh::getTopRight() const
+    {
+        return top_right_;
+    }
+
+    int Navmesh::insertVertex(const Vector2D &vertex)
+    {
+        if (vertex.getX() < bottom_left_.getX() + vertex_tolerance
+            || vertex.getX() > top_right_.getX() - vertex_tolerance
+            || vertex.getY() < bottom_left_.getY() + vertex_tolerance
+            || vertex.getY() > top_right_.getY() - vertex_tolerance)
+            return -1;
+
+        int first = locate(vertex, last_triangle_);
+        if (first == -1)
+            return -1;
+        for (int v : triangles_[first].vertices)
+            if (vertices_[v].squaredDistance(vertex) < vertex_tolerance * vertex_tolerance)
+                return v;
+
+        // The cavity : the triangles whose circumcircle contains the vertex, connected to the one containing it
+        // without crossing a constrained edge
+        auto stamp = nextVisitStamp();
+        in_cavity_.resize(triangles_.size(), false);
+        cavity_.clear();
+        split_edges_.clear();
+        stack_.assign(1, first);
+        visit_stamps_[first] = stamp;
+        in_cavity_[first] = true;
+        while (!stack_.empty())
+        {
+            int triangle = stack_.back();
+            stack_.pop_back();
+            cavity_.push_back(triangle);
+            const auto &current = triangles_[triangle];
+            for (int i = 0; i < 3; i++)
+            {
+                int neighbour = current.neighbours[i];
+                if (neighbour == -1 || visit_stamps_[neighbour] == stamp)
+                    continue;
+                visit_stamps_[neighbour] = stamp;
+                int from = current.vertices[i];
+                int to = current.vertices[(i + 1) % 3];
+                if (current.constrained[i] && isOnEdge(from, to, vertex))
+                {
+                    split_edges_.emplace_back(from, to);
+                    in_cavity_[neighbour] = true;
+                }
+                else
+                {
+                    const auto &vertices = triangles_[neighbour].vertices;
+                    in_cavity_[neighbour] = !current.constrained[i]
+                                            && isInCircumcircle(vertices[0], vertices[1], vertices[2], vertex);
+                }
+                if (in_cavity_[neighbour])
+                    stack_.push_back(neighbour);
+            }
+        }
+
+        boundary_.clear();
+        for (int triangle : cavity_)
+        {
+            const auto &current = triangles_[triangle];
+            for (int i = 0; i < 3; i++)
+            {
+                int neighbour = current.neighbours[i];
+                if (neighbour == -1 || visit_stamps_[neighbour] != stamp || !in_cavity_[neighbour])
+                    boundary_.push_back({current.vertices[i], current.vertices[(i + 1) % 3], neighbour,
+                                         current.constrained[i]});
+            }
+        }
+
+        int new_vertex;
+        if (free_vertices_.empty())
+        {
+            new_vertex = static_cast<int>(vertices_.size());
+            vertices_.push_back(vertex);
+            vertex_triangles_.push_back(-1);
+            vertex_references_.push_back(0);
+        }
+        else
+        {
+            new_vertex = free_vertices_.back();
+            free_vertices_.pop_back();
+            vertices_[new_vertex] = vertex;
+            vertex_references_[new_vertex] = 0;
+        }
+        for (int triangle : cavity_)
+            freeTriangle(triangle);
+
+        // A fan of triangles around the new vertex, one per edge of the cavity boundary
+        cavity_.clear();
+        for (const auto &edge : boundary_)
+        {
+            cavity_.push_back(createTriangle(edge.from, edge.to, new_vertex, edge.neighbour, -1, -1));
+            triangles_[cavity_.back()].constrained[0] = edge.constrained;
+        }
+        for (std::size_t i = 0; i < boundary_.size(); i++)
+        {
+            auto &triangle = triangles_[cavity_[i]];
+            for (std::size_t j = 0; j < boundary_.size(); j++)
+            {
+                if (boundary_[j].from == boundary_[i].to)
+                    triangle.neighbours[1] = cavity_[j];
+                if (boundary_[j].to == boundary_[i].from)
+                    triangle.neighbours[2] = cavity_[j];
+            }
+
+            // The halves of a split edge are the spokes to its ends
+            for (const auto &edge : split_edges_)
+            {
+                triangle.constrained[1] |= boundary_[i].to == edge.first || boundary_[i].to == edge.second;
+                triangle.constrained[2] |= boundary_[i].from == edge.first || boundary_[i].from == edge.second;
+            }
+        }
+        for (const auto &edge : split_edges_)
+            splitConstraint(edge.first, edge.second, new_vertex);
+
+        last_triangle_ = cavity_.front();
+        return new_vertex;
+    }
+
+    void Navmesh::removeVertex(int vertex)
+    {
+        // The link of the vertex, counterclockwise, and the triangles across its edges
+        link_.clear();
+        outer_.clear();
+        outer_constrained_.clear();
+        int start = vertex_triangles_[vertex];
+        int triangle = start;
+        do
+        {
+            const auto &current = triangles_[triangle];
+            int k = current.vertices[0] == vertex ? 0 : current.vertices[1] == vertex ? 1 : 2;
+            link_.push_back(current.vertices[(k + 1) % 3]);
+            outer_.push_back(current.neighbours[(k + 1) % 3]);
+            outer_constrained_.push_back(current.constrained[(k + 1) % 3]);
+            int next = current.neighbours[(k + 2) % 3];
+            freeTriangle(triangle);
+            triangle = next;
+        } while (triangle != start && triangle != -1);
+
+        vertex_triangles_[vertex] = -1;
+        vertex_references_[vertex] = -1;
+        free_vertices_.push_back(vertex);
+
+        // Fills the hole with Delaunay ears : the circumcircle of the ear contains no other vertex of the link
+        while (link_.size() > 3)
+        {
+            auto size = link_.size();
+            std::size_t ear = size;
+            std::size_t fallback = size;
+            for (std::size_t i = 0; i < size && ear == size; i++)
+            {
+                int a = link_[i], b = link_[(i + 1) % size], c = link_[(i + 2) % size];
+                if (Vector2D::orientation(vertices_[a], vertices_[b], vertices_[c]) <= 0)
+                    continue;
+                bool valid = true, delaunay = true;
+                for (std::size_t j = 3; j < size && valid; j++)
+                {
+                    const auto &other = vertices_[link_[(i + j) % size]];
+                    delaunay = delaunay && !isInCircumcircle(a, b, c, other);
+                    valid = Vector2D::orientation(vertices_[a], vertices_[b], other) < 0
+                            || Vector2D::orientation(vertices_[b], vertices_[c], other) < 0
+                            || Vector2D::orientation(vertices_[c], vertices_[a], other) < 0;
+                }
+                if (valid && delaunay)
+                    ear = i;
+                else if (valid && fallback == size)
+                    fallback = i;
+            }
+            // Cocircular vertices, e.g. around the center of a regular polygon, may leave no strictly Delaunay ear
+            if (ear == size)
+                ear = fallback;
+            if (ear == size)
+                break;
+
+            auto middle = (ear + 1) % size;
+            int created = createTriangle(link_[ear], link_[middle], link_[(ear + 2) % size], outer_[ear],
+                                         outer_[middle], -1);
+            triangles_[created].constrained[0] = outer_constrained_[ear];
+            triangles_[created].constrained[1] = outer_constrained_[middle];
+            outer_[ear] = created;
+            outer_constrained_[ear] = false;
+            link_.erase(link_.begin() + middle);
+            outer_.erase(outer_.begin() + middle);
+            outer_constrained_.erase(outer_constrained_.begin() + middle);
+        }
+        last_triangle_ = createTriangle(link_[0], link_[1], link_[2], outer_[0], outer_[1], outer_[2]);
+        for (int i = 0; i < 3; i++)
+            triangles_[last_triangle_].constrained[i] = outer_constrained_[i];
+    }
+
+    int Navmesh::createTriangle(int a, int b, int c, int neighbour_ab, int neighbour_bc, int neighbour_ca)
+    {
+        int triangle;
+        if (free_triangles_.empty())
+        {
+            triangle = static_cast<int>(triangles_.size());
+            triangles_.emplace_back();
+        }
+        else
+        {
+            triangle = free_triangles_.back();
+            free_triangles_.pop_back();
+        }
+        triangles_[triangle] = {{a, b, c}, {neighbour_ab, neighbour_bc, neighbour_ca}, {false, false, false}, false,
+                                true};
+        touched_.push_back(triangle);
+
+        // The neighbours across the given edges link back to the new triangle
+        const auto &created = triangles_[triangle];
+        for (int i = 0; i < 3; i++)
+        {
+            int from = created.vertices[i];
+            int to = created.vertices[(i + 1) % 3];
+            vertex_triangles_[from] = triangle;
+            if (created.neighbours[i] == -1)
+                continue;
+            auto &neighbour = triangles_[created.neighbours[i]];
+            for (int j = 0; j < 3; j++)
+                if (neighbour.vertices[j] == to && neighbour.vertices[(j + 1) % 3] == from)
+                    neighbour.neighbours[j] = triangle;
+        }
+        return triangle;
+    }
+
+    void Navmesh::freeTriangle(int triangle)
+    {
+        triangles_[triangle].alive = false;
+        free_triangles_.push_back(triangle);
+    }
+
+    void Navmesh::insertConstraint(int from, int to, Polygon &polygon)
+    {
+        if (from == to)
+            return;
+        int triangle, edge;
+        if (findEdge(from, to, triangle, edge))
+        {
+            setConstrained(triangle, edge, true);
+            polygon.edges.emplace_back(from, to);
+            return;
+        }
+
+        // The vertices in the way are inserted first : the middle moves them away from the edge
+        Vector2D middle = vertices_[from] + vertices_[to];
+        middle *= 0.5f;
+        int vertex = insertVertex(middle);
+        if (vertex == -1 || vertex == from || vertex == to)
+            return;
+        vertex_references_[vertex]++;
+        polygon.vertices.push_back(vertex);
+        insertConstraint(from, vertex, polygon);
+        insertConstraint(vertex, to, polygon);
+    }
+
+    void Navmesh::splitConstraint(int from, int to, int vertex)
+    {
+        for (auto &polygon : polygons_)
+        {
+            if (!polygon.alive)
+                continue;
+            auto edge_count = polygon.edges.size();
+            for (std::size_t i = 0; i < edge_count; i++)
+            {
+                auto &edge = polygon.edges[i];
+                if (!(edge.first == from && edge.second == to) && !(edge.first == to && edge.second == from))
+                    continue;
+                int end = edge.second;
+                edge.second = vertex;
+                polygon.edges.emplace_back(vertex, end);
+                polygon.vertices.push_back(vertex);
+                vertex_references_[vertex]++;
+            }
+        }
+    }
+
+    bool Navmesh::isConstraint(int from, int to) const
+    {
+        for (const auto &polygon : polygons_)
+        {
+            if (!polygon.alive)
+                continue;
+            for (const auto &edge : polygon.edges)
+                if ((edge.first == from && edge.second == to) || (edge.first == to && edge.second == from))
+                    return true;
+        }
+        return false;
+    }
+
+    void Navmesh::setConstrained(int triangle, int edge, bool constrained)
+    {
+        auto &current = triangles_[triangle];
+        current.constrained[edge] = constrained;
+        int neighbour = current.neighbours[edge];
+        if (neighbour == -1)
+            return;
+        int from = current.vertices[edge];
+        int to = current.vertices[(edge + 1) % 3];
+        auto &other = triangles_[neighbour];
+        for (int j = 0; j < 3; j++)
+            if (other.vertices[j] == to && other.vertices[(j + 1) % 3] == from)
+                other.constrained[j] = constrained;
+    }
+
+    bool Navmesh::findEdge(int from, int to, int &triangle, int &edge) const
+    {
+        int start = vertex_triangles_[from];
+        if (start == -1)
+            return false;
+
+        // Turns around the vertex, then the other way if the border of the table stops the first turn
+        for (int direction = 0; direction < 2; direction++)
+        {
+            int current = start;
+            do
+            {
+                const auto &vertices = triangles_[current].vertices;
+                int k = vertices[0] == from ? 0 : vertices[1] == from ? 1 : 2;
+                if (vertices[(k + 1) % 3] == to || vertices[(k + 2) % 3] == to)
+                {
+                    triangle = current;
+                    edge = vertices[(k + 1) % 3] == to ? k : (k + 2) % 3;
+                    return true;
+                }
+                current = triangles_[current].neighbours[direction == 0 ? (k + 2) % 3 : k];
+            } while (current != start && current != -1);
+            if (current == start)
+                return false;
+        }
+        return false;
+    }
+
+    void Navmesh::legalizeEdges()
+    {
+        // Rounding errors may flip the edges of cocircular vertices back and forth
+        std::size_t max_flips = 4 * triangles_.size();
+        for (std::size_t flips = 0; !edge_stack_.empty() && flips < max_flips;)
+        {
+            auto edge = edge_stack_.back();
+            edge_stack_.pop_back();
+            int triangle, index;
+            if (!findEdge(edge.first, edge.second, triangle, index))
+                continue;
+            const auto &current = triangles_[triangle];
+            int neighbour = current.neighbours[index];
+            if (neighbour == -1 || current.constrained[index])
+                continue;
+            const auto &other = triangles_[neighbour].vertices;
+            int a = current.vertices[index], b = current.vertices[(index + 1) % 3];
+            int c = current.vertices[(index + 2) % 3];
+            int d = other[0] != a && other[0] != b ? other[0] : other[1] != a && other[1] != b ? other[1] : other[2];
+            if (!isInCircumcircle(a, b, c, vertices_[d]))
+                continue;
+
+            flipEdge(triangle, index);
+            flips++;
+            edge_stack_.emplace_back(c, a);
+            edge_stack_.emplace_back(a, d);
+            edge_stack_.emplace_back(d, b);
+            edge_stack_.emplace_back(b, c);
+        }
+        edge_stack_.clear();
+    }
+
+    void Navmesh::flipEdge(int triangle, int edge)
+    {
+        // (a, b, c) and (b, a, d) become (c, a, d) and (d, b, c)
+        int neighbour = triangles_[triangle].neighbours[edge];
+        auto current = triangles_[triangle];
+        auto other = triangles_[neighbour];
+        int j = other.vertices[0] == current.vertices[(edge + 1) % 3] ? 0
+                : other.vertices[1] == current.vertices[(edge + 1) % 3] ? 1 : 2;
+        int a = current.vertices[edge], b = current.vertices[(edge + 1) % 3], c = current.vertices[(edge + 2) % 3];
+        int d = other.vertices[(j + 2) % 3];
+        int neighbour_bc = current.neighbours[(edge + 1) % 3], neighbour_ca = current.neighbours[(edge + 2) % 3];
+        int neighbour_ad = other.neighbours[(j + 1) % 3], neighbour_db = other.neighbours[(j + 2) % 3];
+
+        triangles_[triangle] = {{c, a, d}, {neighbour_ca, neighbour_ad, neighbour},
+                                {current.constrained[(edge + 2) % 3], other.constrained[(j + 1) % 3], false},
+                                false, true};
+        triangles_[neighbour] = {{d, b, c}, {neighbour_db, neighbour_bc, triangle},
+                                 {other.constrained[(j + 2) % 3], current.constrained[(edge + 1) % 3], false},
+                                 false, true};
+        replaceNeighbour(neighbour_ad, neighbour, triangle);
+        replaceNeighbour(neighbour_bc, triangle, neighbour);
+        vertex_triangles_[a] = triangle;
+        vertex_triangles_[c] = triangle;
+        vertex_triangles_[b] = neighbour;
+        vertex_triangles_[d] = neighbour;
+        touched_.push_back(triangle);
+        touched_.push_back(neighbour);
+    }
+
+    void Navmesh::replaceNeighbour(int triangle, int previous, int neighbour)
+    {
+        if (triangle == -1)
+            return;
+        for (int &current : triangles_[triangle].neighbours)
+            if (current == previous)
+                current = neighbour;
+    }
+
+    bool Navmesh::isOnEdge(int from, int to, const Vector2D &point) const
+    {
+        const auto &a = vertices_[from];
+        const auto &b = vertices_[to];
+        if (Vector2D::orientation(a, b, point) != 0)
+            return false;
+        float position = (point - a).dot(b - a);
+        return position > 0 && position < a.squaredDistance(b);
+    }
+
+    void Navmesh::updateBlocked(const std::vector<Vector2D> &outline)
+    {
+        // The triangles created by the operation, then the ones inside the outline, e.g. kept from a previous
+        // triangulation of the polygon
+        auto stamp = nextVisitStamp();
+        stack_.clear();
+        for (int triangle : touched_)
+        {
+            if (!triangles_[triangle].alive || visit_stamps_[triangle] == stamp)
+                continue;
+            visit_stamps_[triangle] = stamp;
+            stack_.push_back(triangle);
+        }
+
+        while (!stack_.empty())
+        {
+            int triangle = stack_.back();
+            stack_.pop_back();
+            auto &current = triangles_[triangle];
+            current.blocked = isBlocked(getCentroid(triangle));
+            for (int neighbour : current.neighbours)
+            {
+                if (neighbour == -1 || visit_stamps_[neighbour] == stamp)
+                    continue;
+                visit_stamps_[neighbour] = stamp;
+                if (isInsidePolygon(outline, getCentroid(neighbour)))
+                    stack_.push_back(neighbour);
+            }
+        }
+    }
+
+    void Navmesh::updateLocator()
+    {
+        int hint = -1;
+        float min_x = top_right_.getX(), min_y = top_right_.getY();
+        float max_x = bottom_left_.getX(), max_y = bottom_left_.getY();
+        for (int triangle : touched_)
+        {
+            if (!triangles_[triangle].alive)
+                continue;
+            hint = triangle;
+            for (int vertex : triangles_[triangle].vertices)
+            {
+                min_x = std::min(min_x, vertices_[vertex].getX());
+                min_y = std::min(min_y, vertices_[vertex].getY());
+                max_x = std::max(max_x, vertices_[vertex].getX());
+                max_y = std::max(max_y, vertices_[vertex].getY());
+            }
+        }
+        if (hint != -1)
+            locator_.update(*this, Vector2D(min_x, min_y), Vector2D(max_x, max_y), hint);
+    }
+
+    bool Navmesh::isBlocked(const Vector2D &point) const
+    {
+        for (const auto &polygon : polygons_)
+        {
+            if (polygon.alive
+                && point.getX() >= polygon.bottom_left.getX() && point.getX() <= polygon.top_right.getX()
+                && point.getY() >= polygon.bottom_left.getY() && point.getY() <= polygon.top_right.getY()
+                && isInsidePolygon(polygon.outline, point))
+                return true;
+        }
+        return false;
+    }
+
+    bool Navmesh::isInCircumcircle(int a, int b, int c, const Vector2D &point) const
+    {
+        // Sign of the incircle determinant of a counterclockwise triangle, in double
+        Vector2DT<double> p(point);
+        Vector2DT<double> pa = Vector2DT<double>(vertices_[a]) - p;
+        Vector2DT<double> pb = Vector2DT<double>(vertices_[b]) - p;
+        Vector2DT<double> pc = Vector2DT<double>(vertices_[c]) - p;
+        double determinant = pa.squaredNorm() * (pb.getX() * pc.getY() - pc.getX() * pb.getY())
+                             - pb.squaredNorm() * (pa.getX() * pc.getY() - pc.getX() * pa.getY())
+                             + pc.squaredNorm() * (pa.getX() * pb.getY() - pb.getX() * pa.getY());
+        return determinant > 0;
+    }
+
+    bool Navmesh::isInsidePolygon(const std::vector<Vector2D> &polygon, const Vector2D &point) const
+    {
+        for (std::size_t i = 0; i < polygon.size(); i++)
+            if (Vector2D::orientation(polygon[i], polygon[(i + 1) % polygon.size()], point) < 0)
+                return false;
+        return true;
+    }
+
+    unsigned int Navmesh::nextVisitStamp()
+    {
+        if (++visit_stamp_ == 0)
+        {
+            std::fill(visit_stamps_.begin(), visit_stamps_.end(), 0);
+            visit_stamp_ = 1;
+        }
+        visit_stamps_.resize(triangles_.size(), 0);
+        return visit_stamp_;
+    }
+}
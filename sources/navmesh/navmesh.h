@@ -0,0 +1,204 @@
+#ifndef KRAKEN_NAVMESH_H
+#define KRAKEN_NAVMESH_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "point_locator.h"
+#include "../obstacles/circular_obstacle.h"
+#include "../struct/vector_2d.h"
+
+namespace kraken
+{
+    /*
+     * A counterclockwise triangle. neighbours[i] is the triangle across the edge (vertices[i], vertices[(i + 1) % 3]),
+     * -1 on the border of the table.
+     */
+    struct NavmeshTriangle
+    {
+        int vertices[3];
+        int neighbours[3];
+
+        //The edge i is on the outline of a fixed obstacle : the insertions and the flips keep it
+        bool constrained[3];
+
+        //Inside a fixed obstacle
+        bool blocked;
+
+        //False for a free slot, reused by the next insertion
+        bool alive;
+    };
+
+    /*
+     * Constrained Delaunay triangulation of the table, refined around the fixed obstacles.
+     * The obstacles are convex polygons : their vertices are inserted in the triangulation (Bowyer-Watson), their long
+     * edges being split first. Then each edge of the outline is split at its middle until it is an edge of the
+     * triangulation, and becomes constrained. No triangle crosses an outline, so the triangles whose centroid is inside
+     * a polygon, which are blocked, cover it exactly.
+     * Adding or removing a polygon only retriangulates the cavities around its vertices, and updates the blocked
+     * flags and the point location grid there. The triangle indices are stable : a removed triangle leaves a free slot.
+     * To update a navmesh shared with running searches, modify a copy (see PlannerService::addFixedObstacle).
+     */
+    class Navmesh
+    {
+    public:
+        /**
+         * @param bottom_left
+         * @param top_right
+         * @param cell_size size of the cells of the point location grid, and maximal length of an obstacle edge, in mm
+         */
+        Navmesh(const Vector2D &bottom_left, const Vector2D &top_right, float cell_size = 100);
+
+        /**
+         * @param polygon convex, in any orientation
+         * @return the identifier of the polygon, -1 if it has less than 3 vertices
+         */
+        int addPolygon(const std::vector<Vector2D> &polygon);
+
+        /**
+         * Removes a polygon and its vertices, unless another polygon shares them
+         * @param polygon identifier returned by addPolygon, an unknown identifier is ignored
+         */
+        void removePolygon(int polygon);
+
+        /**
+         * @param polygon
+         * @return true if the polygon was added and not removed yet
+         */
+        bool hasPolygon(int polygon) const;
+
+        /**
+         * The polygon circumscribed to a circular obstacle
+         * @param obstacle
+         * @param vertex_count
+         * @return
+         */
+        static std::vector<Vector2D> getPolygon(const CircularObstacle &obstacle, int vertex_count = 8);
+
+        /**
+         * @param point
+         * @param hint a triangle near the point, e.g. the result of the previous query along a path, or -1
+         * @return the triangle containing the point, -1 if the point is outside the table
+         */
+        int locate(const Vector2D &point, int hint = -1) const;
+
+        bool contains(int triangle, const Vector2D &point) const;
+        Vector2D getCentroid(int triangle) const;
+
+        const NavmeshTriangle &getTriangle(int triangle) const;
+        const Vector2D &getVertex(int vertex) const;
+
+        /**
+         * @return the number of triangle slots, some of them may be free
+         */
+        std::size_t getTriangleCount() const;
+        std::size_t getVertexCount() const;
+        const Vector2D &getBottomLeft() const;
+        const Vector2D &getTopRight() const;
+
+    private:
+        struct Polygon
+        {
+            //Counterclockwise
+            std::vector<Vector2D> outline;
+            Vector2D bottom_left;
+            Vector2D top_right;
+            std::vector<int> vertices;
+            //The constrained edges of the outline
+            std::vector<std::pair<int, int>> edges;
+            bool alive;
+        };
+
+        struct BoundaryEdge
+        {
+            int from;
+            int to;
+            int neighbour;
+            bool constrained;
+        };
+
+        /**
+         * The cavity of the vertex doesn't cross the constrained edges, unless the vertex is on one of them : the edge
+         * is then split, for every polygon using it
+         * @param vertex
+         * @return the inserted vertex, an existing vertex closer than the tolerance, or -1 outside the table
+         */
+        int insertVertex(const Vector2D &vertex);
+        void removeVertex(int vertex);
+        int createTriangle(int a, int b, int c, int neighbour_ab, int neighbour_bc, int neighbour_ca);
+        void freeTriangle(int triangle);
+
+        /**
+         * Splits the edge at its middle until it is an edge of the triangulation, then constrains it
+         * @param from
+         * @param to
+         * @param polygon takes a reference to the vertices inserted by the splits
+         */
+        void insertConstraint(int from, int to, Polygon &polygon);
+        void splitConstraint(int from, int to, int vertex);
+        bool isConstraint(int from, int to) const;
+        void setConstrained(int triangle, int edge, bool constrained);
+
+        /**
+         * @param from
+         * @param to
+         * @param triangle output, a triangle with the edge
+         * @param edge output, the index of the edge in the triangle
+         * @return false if the vertices are not linked
+         */
+        bool findEdge(int from, int to, int &triangle, int &edge) const;
+
+        /**
+         * Flips the edges of edge_stack_, and the ones around them, until they are Delaunay or constrained
+         */
+        void legalizeEdges();
+        void flipEdge(int triangle, int edge);
+        void replaceNeighbour(int triangle, int previous, int neighbour);
+        bool isOnEdge(int from, int to, const Vector2D &point) const;
+
+        /**
+         * Recomputes the blocked flags of the triangles created by the last operation, and of the triangles around
+         * them whose centroid is inside the outline
+         * @param outline
+         */
+        void updateBlocked(const std::vector<Vector2D> &outline);
+        void updateLocator();
+        bool isBlocked(const Vector2D &point) const;
+        bool isInCircumcircle(int a, int b, int c, const Vector2D &point) const;
+        bool isInsidePolygon(const std::vector<Vector2D> &polygon, const Vector2D &point) const;
+        unsigned int nextVisitStamp();
+
+        Vector2D bottom_left_;
+        Vector2D top_right_;
+        float max_edge_length_;
+        std::vector<Vector2D> vertices_;
+        std::vector<NavmeshTriangle> triangles_;
+        std::vector<int> free_triangles_;
+        std::vector<Polygon> polygons_;
+        PointLocator locator_;
+        int last_triangle_;
+
+        //Per vertex : a triangle using it, and the number of polygons using it (-1 for a free slot)
+        std::vector<int> vertex_triangles_;
+        std::vector<int> vertex_references_;
+        std::vector<int> free_vertices_;
+
+        //Scratch buffers of the updates
+        std::vector<int> touched_;
+        std::vector<int> cavity_;
+        std::vector<int> stack_;
+        std::vector<BoundaryEdge> boundary_;
+        std::vector<std::pair<int, int>> split_edges_;
+        std::vector<std::pair<int, int>> edge_stack_;
+        std::vector<int> outline_vertices_;
+        std::vector<int> link_;
+        std::vector<int> outer_;
+        std::vector<bool> outer_constrained_;
+        std::vector<unsigned int> visit_stamps_;
+        std::vector<bool> in_cavity_;
+        unsigned int visit_stamp_;
+    };
+}
+
+#endif //KRAKEN_NAVMESH_H
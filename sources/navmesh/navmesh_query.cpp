@@ -0,0 +1,283 @@
+#include "navmesh_query.h"
+
+#include <algorithm>
+
+namespace kraken
+{
+    namespace
+    {
+        //Twice the signed area of (a, b, c) : positive if c is on the left of (a, b)
+        float cross(const Vector2D &a, const Vector2D &b, const Vector2D &c)
+        {
+            return (b.getX() - a.getX()) * (c.getY() - a.getY()) - (b.getY() - a.getY()) * (c.getX() - a.getX());
+        }
+    }
+
+    NavmeshQuery::NavmeshQuery() : visit_stamp_(0)
+    {
+
+    }
+
+    bool NavmeshQuery::OpenTriangle::operator<(const OpenTriangle &rhs) const
+    {
+        // std::push_heap makes a max-heap
+        return estimated_cost > rhs.estimated_cost;
+    }
+
+    bool NavmeshQuery::findPath(const Navmesh &navmesh, const Vector2D &start, const Vector2D &goal,
+                                std::vector<Vector2D> &path, int start_hint)
+    {
+        path.clear();
+        int start_triangle = navmesh.locate(start, start_hint);
+        int goal_triangle = navmesh.locate(goal, start_triangle);
+        if (start_triangle == -1 || goal_triangle == -1 || navmesh.getTriangle(goal_triangle).blocked)
+            return false;
+        if (!findCorridor(navmesh, start_triangle, goal_triangle, start, goal))
+            return false;
+        pullString(navmesh, start, goal, path);
+        return true;
+    }
+
+    void NavmeshQuery::findPathLengths(const Navmesh &navmesh, const Vector2D &start,
+                                       const std::vector<Vector2D> &goals, std::vector<float> &lengths,
+                                       int start_hint)
+    {
+        lengths.assign(goals.size(), std::numeric_limits<float>::infinity());
+        int start_triangle = navmesh.locate(start, start_hint);
+        if (start_triangle == -1)
+            return;
+
+        goal_triangles_.clear();
+        for (const auto &goal : goals)
+        {
+            int goal_triangle = navmesh.locate(goal, start_triangle);
+            goal_triangles_.push_back(goal_triangle != -1 && navmesh.getTriangle(goal_triangle).blocked
+                                      ? -1 : goal_triangle);
+        }
+        auto &remaining = sorted_goal_triangles_;
+        remaining.assign(goal_triangles_.begin(), goal_triangles_.end());
+        std::sort(remaining.begin(), remaining.end());
+        remaining.erase(std::unique(remaining.begin(), remaining.end()), remaining.end());
+        if (!remaining.empty() && remaining.front() == -1)
+            remaining.erase(remaining.begin());
+
+        // Dijkstra : the open list is ordered by the cost only
+        beginVisit(navmesh, start_triangle, start);
+        open_list_.push_back({0, start_triangle});
+        std::size_t remaining_count = remaining.size();
+        while (!open_list_.empty() && remaining_count > 0)
+        {
+            std::pop_heap(open_list_.begin(), open_list_.end());
+            auto current = open_list_.back();
+            open_list_.pop_back();
+            if (current.estimated_cost > costs_[current.triangle])
+                continue;
+            if (std::binary_search(remaining.begin(), remaining.end(), current.triangle))
+                remaining_count--;
+
+            const auto &triangle = navmesh.getTriangle(current.triangle);
+            for (int i = 0; i < 3; i++)
+            {
+                int neighbour = triangle.neighbours[i];
+                if (neighbour == -1 || navmesh.getTriangle(neighbour).blocked)
+                    continue;
+
+                Vector2D entry = navmesh.getVertex(triangle.vertices[i])
+                                 + navmesh.getVertex(triangle.vertices[(i + 1) % 3]);
+                entry *= 0.5f;
+                float cost = costs_[current.triangle] + entries_[current.triangle].distance(entry);
+                if (visit_stamps_[neighbour] == visit_stamp_ && costs_[neighbour] <= cost)
+                    continue;
+
+                visit_stamps_[neighbour] = visit_stamp_;
+                costs_[neighbour] = cost;
+                parents_[neighbour] = current.triangle;
+                entries_[neighbour] = entry;
+                open_list_.push_back({cost, neighbour});
+                std::push_heap(open_list_.begin(), open_list_.end());
+            }
+        }
+
+        // The costs between portal middles only rank the triangles, the lengths come from the taut paths
+        for (std::size_t i = 0; i < goals.size(); i++)
+        {
+            int goal_triangle = goal_triangles_[i];
+            if (goal_triangle == -1 || visit_stamps_[goal_triangle] != visit_stamp_)
+                continue;
+            buildCorridor(goal_triangle);
+            path_.clear();
+            pullString(navmesh, start, goals[i], path_);
+            lengths[i] = getLength(path_);
+        }
+    }
+
+    const std::vector<int> &NavmeshQuery::getCorridor() const
+    {
+        return corridor_;
+    }
+
+    float NavmeshQuery::getLength(const std::vector<Vector2D> &path)
+    {
+        float length = 0;
+        for (std::size_t i = 1; i < path.size(); i++)
+            length += path[i - 1].distance(path[i]);
+        return length;
+    }
+
+    void NavmeshQuery::beginVisit(const Navmesh &navmesh, int start, const Vector2D &start_position)
+    {
+        if (++visit_stamp_ == 0)
+        {
+            std::fill(visit_stamps_.begin(), visit_stamps_.end(), 0);
+            visit_stamp_ = 1;
+        }
+        if (visit_stamps_.size() < navmesh.getTriangleCount())
+        {
+            visit_stamps_.resize(navmesh.getTriangleCount(), 0);
+            costs_.resize(navmesh.getTriangleCount());
+            parents_.resize(navmesh.getTriangleCount());
+            entries_.resize(navmesh.getTriangleCount());
+        }
+
+        // The triangles are entered at the middle of their portal
+        open_list_.clear();
+        visit_stamps_[start] = visit_stamp_;
+        costs_[start] = 0;
+        parents_[start] = -1;
+        entries_[start] = start_position;
+    }
+
+    bool NavmeshQuery::findCorridor(const Navmesh &navmesh, int start, int goal, const Vector2D &start_position,
+                                    const Vector2D &goal_position)
+    {
+        beginVisit(navmesh, start, start_position);
+        open_list_.push_back({start_position.distance(goal_position), start});
+
+        bool found = false;
+        while (!open_list_.empty())
+        {
+            std::pop_heap(open_list_.begin(), open_list_.end());
+            auto current = open_list_.back();
+            open_list_.pop_back();
+            if (current.estimated_cost > costs_[current.triangle] + entries_[current.triangle].distance(goal_position))
+                continue;
+            if (current.triangle == goal)
+            {
+                found = true;
+                break;
+            }
+
+            const auto &triangle = navmesh.getTriangle(current.triangle);
+            for (int i = 0; i < 3; i++)
+            {
+                int neighbour = triangle.neighbours[i];
+                if (neighbour == -1 || navmesh.getTriangle(neighbour).blocked)
+                    continue;
+
+                Vector2D entry = navmesh.getVertex(triangle.vertices[i])
+                                 + navmesh.getVertex(triangle.vertices[(i + 1) % 3]);
+                entry *= 0.5f;
+                float cost = costs_[current.triangle] + entries_[current.triangle].distance(entry);
+                if (visit_stamps_[neighbour] == visit_stamp_ && costs_[neighbour] <= cost)
+                    continue;
+
+                visit_stamps_[neighbour] = visit_stamp_;
+                costs_[neighbour] = cost;
+                parents_[neighbour] = current.triangle;
+                entries_[neighbour] = entry;
+                open_list_.push_back({cost + entry.distance(goal_position), neighbour});
+                std::push_heap(open_list_.begin(), open_list_.end());
+            }
+        }
+        if (!found)
+            return false;
+
+        buildCorridor(goal);
+        return true;
+    }
+
+    void NavmeshQuery::buildCorridor(int goal)
+    {
+        corridor_.clear();
+        for (int triangle = goal; triangle != -1; triangle = parents_[triangle])
+            corridor_.push_back(triangle);
+        std::reverse(corridor_.begin(), corridor_.end());
+    }
+
+    void NavmeshQuery::pullString(const Navmesh &navmesh, const Vector2D &start, const Vector2D &goal,
+                                  std::vector<Vector2D> &path)
+    {
+        // The portals, seen from the start : the right vertex of the edge shared with the next triangle comes first
+        // in the counterclockwise order of the current triangle
+        left_portals_.assign(1, start);
+        right_portals_.assign(1, start);
+        for (std::size_t k = 0; k + 1 < corridor_.size(); k++)
+        {
+            const auto &triangle = navmesh.getTriangle(corridor_[k]);
+            for (int i = 0; i < 3; i++)
+            {
+                if (triangle.neighbours[i] != corridor_[k + 1])
+                    continue;
+                right_portals_.push_back(navmesh.getVertex(triangle.vertices[i]));
+                left_portals_.push_back(navmesh.getVertex(triangle.vertices[(i + 1) % 3]));
+            }
+        }
+        left_portals_.push_back(goal);
+        right_portals_.push_back(goal);
+
+        // Simple stupid funnel algorithm
+        path.push_back(start);
+        Vector2D apex = start;
+        Vector2D left = start;
+        Vector2D right = start;
+        std::size_t apex_index = 0, left_index = 0, right_index = 0;
+        for (std::size_t i = 1; i < left_portals_.size(); i++)
+        {
+            const auto &new_left = left_portals_[i];
+            const auto &new_right = right_portals_[i];
+
+            if (cross(apex, right, new_right) >= 0)
+            {
+                if (apex == right || cross(apex, left, new_right) < 0)
+                {
+                    right = new_right;
+                    right_index = i;
+                }
+                else
+                {
+                    // The right side crosses the left one : the left vertex is a corner of the path
+                    path.push_back(left);
+                    apex = left;
+                    apex_index = left_index;
+                    right = apex;
+                    right_index = apex_index;
+                    left_index = apex_index;
+                    i = apex_index;
+                    continue;
+                }
+            }
+
+            if (cross(apex, left, new_left) <= 0)
+            {
+                if (apex == left || cross(apex, right, new_left) > 0)
+                {
+                    left = new_left;
+                    left_index = i;
+                }
+                else
+                {
+                    path.push_back(right);
+                    apex = right;
+                    apex_index = right_index;
+                    left = apex;
+                    left_index = apex_index;
+                    right_index = apex_index;
+                    i = apex_index;
+                    continue;
+                }
+            }
+        }
+        if (path.back() != goal)
+            path.push_back(goal);
+    }
+}
@@ -0,0 +1,89 @@
+#ifndef KRAKEN_NAVMESH_QUERY_H
+#define KRAKEN_NAVMESH_QUERY_H
+
+#include <limits>
+#include <vector>
+
+#include "navmesh.h"
+
+namespace kraken
+{
+    /*
+     * Shortest path queries on a navmesh : an A* over the triangles finds the corridor between two points, then the
+     * funnel algorithm pulls the string through its portals.
+     * The buffers are kept between the queries, so a query does not allocate once they have grown. Use one query
+     * object per thread.
+     */
+    class NavmeshQuery
+    {
+    public:
+        NavmeshQuery();
+
+        /**
+         * @param navmesh
+         * @param start its triangle may be blocked, e.g. when the robot touches an obstacle
+         * @param goal
+         * @param path output, cleared first : the taut polyline from start to goal
+         * @param start_hint a triangle near the start, or -1
+         * @return false if the goal cannot be reached without crossing a blocked triangle
+         */
+        bool findPath(const Navmesh &navmesh, const Vector2D &start, const Vector2D &goal,
+                      std::vector<Vector2D> &path, int start_hint = -1);
+
+        /**
+         * Shortest path lengths from one point to many goals : a single Dijkstra over the triangles, stopped once the
+         * triangles of every goal are reached, then the funnel algorithm along the corridor of each goal.
+         * @param navmesh
+         * @param start its triangle may be blocked
+         * @param goals
+         * @param lengths output, one per goal in mm, infinity if the goal cannot be reached
+         * @param start_hint a triangle near the start, or -1
+         */
+        void findPathLengths(const Navmesh &navmesh, const Vector2D &start, const std::vector<Vector2D> &goals,
+                             std::vector<float> &lengths, int start_hint = -1);
+
+        /**
+         * @return the triangles from the start to the goal, found by the last successful findPath query
+         */
+        const std::vector<int> &getCorridor() const;
+
+        /**
+         * @param path
+         * @return the length of the polyline, in mm
+         */
+        static float getLength(const std::vector<Vector2D> &path);
+
+    private:
+        void beginVisit(const Navmesh &navmesh, int start, const Vector2D &start_position);
+        bool findCorridor(const Navmesh &navmesh, int start, int goal, const Vector2D &start_position,
+                          const Vector2D &goal_position);
+        void buildCorridor(int goal);
+        void pullString(const Navmesh &navmesh, const Vector2D &start, const Vector2D &goal,
+                        std::vector<Vector2D> &path);
+
+        struct OpenTriangle
+        {
+            float estimated_cost;
+            int triangle;
+
+            bool operator<(const OpenTriangle &rhs) const;
+        };
+
+        //Per triangle, valid when visit_stamps_ is the current stamp
+        std::vector<unsigned int> visit_stamps_;
+        std::vector<float> costs_;
+        std::vector<int> parents_;
+        std::vector<Vector2D> entries_;
+        unsigned int visit_stamp_;
+
+        std::vector<OpenTriangle> open_list_;
+        std::vector<int> goal_triangles_;
+        std::vector<int> sorted_goal_triangles_;
+        std::vector<Vector2D> path_;
+        std::vector<int> corridor_;
+        std::vector<Vector2D> left_portals_;
+        std::vector<Vector2D> right_portals_;
+    };
+}
+
+#endif //KRAKEN_NAVMESH_QUERY_H
@@ -0,0 +1,129 @@
+#include "point_locator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "navmesh.h"
+
+namespace kraken
+{
+    PointLocator::PointLocator(const Vector2D &bottom_left, const Vector2D &top_right, float cell_size) :
+            bottom_left_(bottom_left), cell_size_(cell_size),
+            columns_(std::max(1, static_cast<int>(std::ceil((top_right.getX() - bottom_left.getX()) / cell_size)))),
+            rows_(std::max(1, static_cast<int>(std::ceil((top_right.getY() - bottom_left.getY()) / cell_size)))),
+            seeds_(static_cast<std::size_t>(columns_ * rows_), -1)
+    {
+
+    }
+
+    void PointLocator::build(const Navmesh &navmesh)
+    {
+        int previous = -1;
+        for (int row = 0; row < rows_; row++)
+        {
+            // Boustrophedon order : the previous seed is always in a neighbouring cell
+            for (int i = 0; i < columns_; i++)
+            {
+                int column = row % 2 == 0 ? i : columns_ - 1 - i;
+                auto &seed = seeds_[row * columns_ + column];
+                // The center of a partial cell may be outside the table
+                seed = locate(navmesh, getCellCenter(column, row), previous);
+                if (seed == -1)
+                    seed = previous;
+                else
+                    previous = seed;
+            }
+        }
+    }
+
+    void PointLocator::update(const Navmesh &navmesh, const Vector2D &bottom_left, const Vector2D &top_right,
+                              int hint)
+    {
+        int first = getCell(bottom_left);
+        int last = getCell(top_right);
+        for (int row = first / columns_; row <= last / columns_; row++)
+        {
+            for (int column = first % columns_; column <= last % columns_; column++)
+            {
+                auto &seed = seeds_[row * columns_ + column];
+                int triangle = locate(navmesh, getCellCenter(column, row), hint);
+                if (triangle != -1)
+                    seed = hint = triangle;
+                else
+                    seed = hint;
+            }
+        }
+    }
+
+    int PointLocator::locate(const Navmesh &navmesh, const Vector2D &point, int hint) const
+    {
+        auto is_valid = [&navmesh](int triangle) {
+            return triangle >= 0 && triangle < static_cast<int>(navmesh.getTriangleCount())
+                   && navmesh.getTriangle(triangle).alive;
+        };
+
+        int start = hint;
+        if (!is_valid(start))
+            start = seeds_[getCell(point)];
+        if (!is_valid(start))
+        {
+            start = -1;
+            for (int triangle = 0; triangle < static_cast<int>(navmesh.getTriangleCount()) && start == -1; triangle++)
+                if (navmesh.getTriangle(triangle).alive)
+                    start = triangle;
+            if (start == -1)
+                return -1;
+        }
+
+        int triangle = walk(navmesh, point, start);
+        if (triangle != -2)
+            return triangle;
+
+        // The walk cycled on a degenerate configuration
+        for (triangle = 0; triangle < static_cast<int>(navmesh.getTriangleCount()); triangle++)
+            if (navmesh.getTriangle(triangle).alive && navmesh.contains(triangle, point))
+                return triangle;
+        return -1;
+    }
+
+    int PointLocator::walk(const Navmesh &navmesh, const Vector2D &point, int start) const
+    {
+        int triangle = start;
+        int previous = -1;
+        for (std::size_t step = 0; step <= navmesh.getTriangleCount(); step++)
+        {
+            const auto &current = navmesh.getTriangle(triangle);
+            int next = triangle;
+            for (int i = 0; i < 3 && next == triangle; i++)
+            {
+                // Never cross back the edge just crossed
+                if (current.neighbours[i] == previous && previous != -1)
+                    continue;
+                const auto &from = navmesh.getVertex(current.vertices[i]);
+                const auto &to = navmesh.getVertex(current.vertices[(i + 1) % 3]);
+                if (Vector2D::orientation(from, to, point) < 0)
+                    next = current.neighbours[i];
+            }
+            if (next == triangle || next == -1)
+                return next;
+            previous = triangle;
+            triangle = next;
+        }
+        return -2;
+    }
+
+    int PointLocator::getCell(const Vector2D &point) const
+    {
+        auto column = static_cast<int>(std::floor((point.getX() - bottom_left_.getX()) / cell_size_));
+        auto row = static_cast<int>(std::floor((point.getY() - bottom_left_.getY()) / cell_size_));
+        column = std::max(0, std::min(columns_ - 1, column));
+        row = std::max(0, std::min(rows_ - 1, row));
+        return row * columns_ + column;
+    }
+
+    Vector2D PointLocator::getCellCenter(int column, int row) const
+    {
+        return Vector2D(bottom_left_.getX() + (column + 0.5f) * cell_size_,
+                        bottom_left_.getY() + (row + 0.5f) * cell_size_);
+    }
+}
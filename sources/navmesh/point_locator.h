@@ -0,0 +1,64 @@
+#ifndef KRAKEN_POINT_LOCATOR_H
+#define KRAKEN_POINT_LOCATOR_H
+
+#include <vector>
+
+#include "../struct/vector_2d.h"
+
+namespace kraken
+{
+    class Navmesh;
+
+    /*
+     * Finds the navmesh triangle containing a point (jump-and-walk).
+     * A grid over the table keeps, for each cell, a seed triangle containing its center. A query jumps to the seed of
+     * its cell, or starts from a hint such as the triangle of the previous point of a tentacle, then walks across the
+     * edges the point is behind. The walk terminates on a Delaunay triangulation and is a few steps long.
+     */
+    class PointLocator
+    {
+    public:
+        /**
+         * @param bottom_left
+         * @param top_right
+         * @param cell_size in mm
+         */
+        PointLocator(const Vector2D &bottom_left, const Vector2D &top_right, float cell_size);
+
+        /**
+         * Recomputes the seeds of every cell
+         * @param navmesh
+         */
+        void build(const Navmesh &navmesh);
+
+        /**
+         * Recomputes the seeds of the cells overlapping a modified region
+         * @param navmesh
+         * @param bottom_left
+         * @param top_right
+         * @param hint a triangle of the region
+         */
+        void update(const Navmesh &navmesh, const Vector2D &bottom_left, const Vector2D &top_right, int hint);
+
+        /**
+         * @param navmesh
+         * @param point
+         * @param hint a triangle near the point, or -1 to start from the grid
+         * @return the triangle containing the point, -1 if the point is outside the navmesh
+         */
+        int locate(const Navmesh &navmesh, const Vector2D &point, int hint = -1) const;
+
+    private:
+        int walk(const Navmesh &navmesh, const Vector2D &point, int start) const;
+        int getCell(const Vector2D &point) const;
+        Vector2D getCellCenter(int column, int row) const;
+
+        Vector2D bottom_left_;
+        float cell_size_;
+        int columns_;
+        int rows_;
+        std::vector<int> seeds_;
+    };
+}
+
+#endif //KRAKEN_POINT_LOCATOR_H
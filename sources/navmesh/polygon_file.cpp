@@ -0,0 +1,48 @@
+#include "polygon_file.h"
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace kraken
+{
+    std::vector<std::vector<Vector2D>> polygon_file::parse(std::istream &strm)
+    {
+        std::vector<std::vector<Vector2D>> polygons;
+        std::string text;
+        std::size_t line_number = 0;
+        while (std::getline(strm, text))
+        {
+            line_number++;
+            text = text.substr(0, text.find('#'));
+            std::istringstream line(text);
+            std::string keyword;
+            if (!(line >> keyword))
+                continue;
+            if (keyword != "polygon")
+                throw std::invalid_argument("Malformed polygon file. Line " + std::to_string(line_number)
+                                            + " : unknown statement " + keyword + ".");
+
+            std::vector<float> coordinates;
+            float coordinate;
+            while (line >> coordinate)
+                coordinates.push_back(coordinate);
+            std::vector<Vector2D> polygon;
+            if (!line.eof() || !toPolygon(coordinates, polygon))
+                throw std::invalid_argument("Malformed polygon file. Line " + std::to_string(line_number)
+                                            + " : expected polygon <x> <y> <x> <y> <x> <y> ...");
+            polygons.push_back(std::move(polygon));
+        }
+        return polygons;
+    }
+
+    bool polygon_file::toPolygon(const std::vector<float> &coordinates, std::vector<Vector2D> &polygon)
+    {
+        if (coordinates.size() < 6 || coordinates.size() % 2 != 0)
+            return false;
+        polygon.clear();
+        for (std::size_t i = 0; i < coordinates.size(); i += 2)
+            polygon.emplace_back(coordinates[i], coordinates[i + 1]);
+        return true;
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef KRAKEN_POLYGON_FILE_H
+#define KRAKEN_POLYGON_FILE_H
+
+#include <istream>
+#include <vector>
+
+#include "../struct/vector_2d.h"
+
+namespace kraken
+{
+    /*
+     * The fixed obstacles of a table, as given to Navmesh::addPolygon. Text format, one polygon per line, '#' starts a
+     * comment, in mm :
+     *   polygon <x> <y> <x> <y> <x> <y> ...         convex
+     * The scenarios of kraken_perfcheck use the same statement.
+     */
+    namespace polygon_file
+    {
+        /**
+         * Throws std::invalid_argument on a malformed line
+         * @param strm
+         * @return
+         */
+        std::vector<std::vector<Vector2D>> parse(std::istream &strm);
+
+        /**
+         * @param coordinates x then y of each vertex
+         * @param polygon output
+         * @return false if there are not at least three vertices
+         */
+        bool toPolygon(const std::vector<float> &coordinates, std::vector<Vector2D> &polygon);
+    }
+}
+
+#endif //KRAKEN_POLYGON_FILE_H
@@ -0,0 +1,52 @@
+#include "circular_obstacle.h"
+#include "../struct/fixed_point_2d.h"
+
+namespace kraken
+{
+    CircularObstacle::CircularObstacle(const Vector2D &position, const float &radius) :
+            position_(position), radius_(radius)
+    {
+
+    }
+
+    bool CircularObstacle::operator==(const CircularObstacle &rhs) const
+    {
+        return position_ == rhs.position_ && radius_ == rhs.radius_;
+    }
+
+    bool CircularObstacle::isColliding(const Vector2D &point) const
+    {
+        return isColliding(point, 0);
+    }
+
+    bool CircularObstacle::isColliding(const Vector2D &point, const float &margin) const
+    {
+#if FIXED_POINT_GEOMETRY
+        std::int64_t distance = FixedPoint2D(Vector2D(radius_ + margin, 0)).getX();
+        return FixedPoint2D(position_).squaredDistance(FixedPoint2D(point)) < distance * distance;
+#else
+        float distance = radius_ + margin;
+        return position_.squaredDistance(point) < distance * distance;
+#endif
+    }
+
+    const Vector2D &CircularObstacle::getPosition() const
+    {
+        return position_;
+    }
+
+    float CircularObstacle::getRadius() const
+    {
+        return radius_;
+    }
+
+#if DEBUG
+
+    std::ostream &operator<<(std::ostream &strm, const CircularObstacle &o)
+    {
+        return strm << "CircularObstacle(" << o.position_.getX() << ", " << o.position_.getY() << ", r : "
+                    << o.radius_ << ")";
+    }
+
+#endif
+}
@@ -0,0 +1,35 @@
+#ifndef KRAKEN_CIRCULAR_OBSTACLE_H
+#define KRAKEN_CIRCULAR_OBSTACLE_H
+
+#if DEBUG
+#include <ostream>
+#endif
+
+#include "../struct/vector_2d.h"
+
+namespace kraken
+{
+    class CircularObstacle
+    {
+    public:
+        CircularObstacle(const Vector2D &position, const float &radius);
+
+        bool operator==(const CircularObstacle &rhs) const;
+
+        bool isColliding(const Vector2D &point) const;
+        bool isColliding(const Vector2D &point, const float &margin) const;
+
+        const Vector2D &getPosition() const;
+        float getRadius() const;
+
+    protected:
+        Vector2D position_;
+        float radius_;
+
+#if DEBUG
+        friend std::ostream &operator<<(std::ostream &strm, const CircularObstacle &o);
+#endif
+    };
+}
+
+#endif //KRAKEN_CIRCULAR_OBSTACLE_H
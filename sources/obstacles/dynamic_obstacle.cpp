@@ -0,0 +1,59 @@
+#include "dynamic_obstacle.h"
+
+#include <limits>
+
+namespace kraken
+{
+    DynamicObstacle::DynamicObstacle(const Vector2D &position, const float &radius, const Vector2D &velocity,
+                                     const float &valid_from, const float &valid_until) :
+            CircularObstacle(position, radius), velocity_(velocity), valid_from_(valid_from),
+            valid_until_(valid_until)
+    {
+
+    }
+
+    DynamicObstacle::DynamicObstacle(const CircularObstacle &obstacle) :
+            CircularObstacle(obstacle), velocity_(0, 0), valid_from_(-std::numeric_limits<float>::infinity()),
+            valid_until_(std::numeric_limits<float>::infinity())
+    {
+
+    }
+
+    bool DynamicObstacle::operator==(const DynamicObstacle &rhs) const
+    {
+        return CircularObstacle::operator==(rhs) && velocity_ == rhs.velocity_ && valid_from_ == rhs.valid_from_
+               && valid_until_ == rhs.valid_until_;
+    }
+
+    Vector2D DynamicObstacle::getPositionAt(const float &time) const
+    {
+        Vector2D displacement = velocity_;
+        displacement *= time;
+        return position_ + displacement;
+    }
+
+    bool DynamicObstacle::isValidAt(const float &time) const
+    {
+        return time >= valid_from_ && time <= valid_until_;
+    }
+
+    bool DynamicObstacle::isColliding(const Vector2D &point, const float &time, const float &margin) const
+    {
+        return isValidAt(time) && CircularObstacle(getPositionAt(time), radius_).isColliding(point, margin);
+    }
+
+    const Vector2D &DynamicObstacle::getVelocity() const
+    {
+        return velocity_;
+    }
+
+    float DynamicObstacle::getValidFrom() const
+    {
+        return valid_from_;
+    }
+
+    float DynamicObstacle::getValidUntil() const
+    {
+        return valid_until_;
+    }
+}
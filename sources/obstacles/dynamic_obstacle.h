@@ -0,0 +1,42 @@
+#ifndef KRAKEN_DYNAMIC_OBSTACLE_H
+#define KRAKEN_DYNAMIC_OBSTACLE_H
+
+#include "circular_obstacle.h"
+
+namespace kraken
+{
+    /*
+     * Circular obstacle moving at constant speed, e.g. the predicted motion of an opponent robot.
+     * The time is in ms relatively to the planning request, the velocity in mm/ms (i.e. m/s). Outside of its validity
+     * interval, the obstacle doesn't exist.
+     */
+    class DynamicObstacle : public CircularObstacle
+    {
+    public:
+        DynamicObstacle(const Vector2D &position, const float &radius, const Vector2D &velocity,
+                        const float &valid_from, const float &valid_until);
+
+        /**
+         * A static obstacle, valid forever
+         */
+        explicit DynamicObstacle(const CircularObstacle &obstacle);
+
+        bool operator==(const DynamicObstacle &rhs) const;
+
+        Vector2D getPositionAt(const float &time) const;
+        bool isValidAt(const float &time) const;
+        using CircularObstacle::isColliding;
+        bool isColliding(const Vector2D &point, const float &time, const float &margin) const;
+
+        const Vector2D &getVelocity() const;
+        float getValidFrom() const;
+        float getValidUntil() const;
+
+    protected:
+        Vector2D velocity_;
+        float valid_from_;
+        float valid_until_;
+    };
+}
+
+#endif //KRAKEN_DYNAMIC_OBSTACLE_H
@@ -0,0 +1,132 @@
+#include "dynamic_obstacle_set.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../instrumentation/search_statistics.h"
+
+namespace kraken
+{
+    DynamicObstacleSet::DynamicObstacleSet(float slice_duration, int slice_count, std::size_t capacity) :
+            slice_duration_(slice_duration), slice_count_(slice_count), capacity_(capacity), rejected_count_(0),
+            slices_(slice_count)
+    {
+        obstacles_.reserve(capacity);
+        static_obstacles_.reserve(capacity);
+        beyond_horizon_.reserve(capacity);
+    }
+
+    void DynamicObstacleSet::clear()
+    {
+        obstacles_.clear();
+        static_obstacles_.clear();
+        beyond_horizon_.clear();
+        for (auto &slice : slices_)
+            slice.clear();
+        rejected_count_ = 0;
+    }
+
+    bool DynamicObstacleSet::add(const DynamicObstacle &obstacle)
+    {
+        if (capacity_ != 0 && obstacles_.size() == capacity_)
+        {
+            rejected_count_++;
+            return false;
+        }
+
+        auto index = static_cast<std::uint32_t>(obstacles_.size());
+        obstacles_.push_back(obstacle);
+
+        const auto &velocity = obstacle.getVelocity();
+        if (velocity.getX() == 0 && velocity.getY() == 0 && std::isinf(obstacle.getValidFrom())
+            && std::isinf(obstacle.getValidUntil()))
+        {
+            static_obstacles_.push_back(index);
+            return true;
+        }
+
+        float horizon = slice_duration_ * slice_count_;
+        if (obstacle.getValidUntil() >= horizon || obstacle.getValidFrom() < 0)
+            beyond_horizon_.push_back(index);
+
+        // The bounds are clamped before the conversion, they may be infinite
+        auto first_slice = static_cast<int>(std::max(0.f, std::floor(obstacle.getValidFrom() / slice_duration_)));
+        auto last_slice = static_cast<int>(std::min(slice_count_ - 1.f,
+                                                    std::floor(obstacle.getValidUntil() / slice_duration_)));
+        float speed = velocity.norm();
+        for (int slice = first_slice; slice <= last_slice; slice++)
+        {
+            // Bounding circle of the obstacle during the part of the slice where it is valid
+            float begin = std::max(slice * slice_duration_, obstacle.getValidFrom());
+            float end = std::min((slice + 1) * slice_duration_, obstacle.getValidUntil());
+            float middle = (begin + end) / 2;
+            slices_[slice].push_back({obstacle.getPositionAt(middle),
+                                      obstacle.getRadius() + speed * (end - begin) / 2, index});
+        }
+        return true;
+    }
+
+    bool DynamicObstacleSet::add(const CircularObstacle &obstacle)
+    {
+        return add(DynamicObstacle(obstacle));
+    }
+
+    const std::vector<DynamicObstacle> &DynamicObstacleSet::getObstacles() const
+    {
+        return obstacles_;
+    }
+
+    std::size_t DynamicObstacleSet::getCapacity() const
+    {
+        return capacity_;
+    }
+
+    std::size_t DynamicObstacleSet::getRejectedCount() const
+    {
+        return rejected_count_;
+    }
+
+    bool DynamicObstacleSet::isColliding(const Vector2D &point, const float &time, const float &margin) const
+    {
+        search_statistics::local().increment(SearchCounter::CollisionChecks);
+
+        if (isCollidingInList(static_obstacles_, point, time, margin))
+            return true;
+
+        float slice_position = std::floor(time / slice_duration_);
+        if (!(slice_position >= 0 && slice_position < slice_count_))
+            return isCollidingInList(beyond_horizon_, point, time, margin);
+
+        auto slice = static_cast<int>(slice_position);
+        for (const auto &entry : slices_[slice])
+        {
+            float distance = entry.radius + margin;
+            if (entry.center.squaredDistance(point) < distance * distance
+                && obstacles_[entry.obstacle].isColliding(point, time, margin))
+                return true;
+        }
+        return false;
+    }
+
+    int DynamicObstacleSet::findFirstCollision(const std::vector<ItineraryPoint> &itinerary,
+                                               const std::vector<float> &arrival_times, const float &margin) const
+    {
+        for (std::size_t i = 0; i < itinerary.size(); i++)
+        {
+            if (isColliding(itinerary[i].getPosition(), arrival_times[i], margin))
+                return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    bool DynamicObstacleSet::isCollidingInList(const std::vector<std::uint32_t> &obstacles, const Vector2D &point,
+                                               const float &time, const float &margin) const
+    {
+        for (auto index : obstacles)
+        {
+            if (obstacles_[index].isColliding(point, time, margin))
+                return true;
+        }
+        return false;
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef KRAKEN_DYNAMIC_OBSTACLE_SET_H
+#define KRAKEN_DYNAMIC_OBSTACLE_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "dynamic_obstacle.h"
+#include "../struct/itinerary_point.h"
+
+namespace kraken
+{
+    /*
+     * Obstacles with a time-indexed broadphase.
+     * The planning horizon is cut in time slices. Every moving obstacle is registered in the slices of its validity
+     * interval with a circle bounding its motion during the slice, so a query only tests the few obstacles near the
+     * point at that time. Static obstacles are tested at any time. Beyond the horizon, every moving obstacle is tested.
+     * With a capacity, the obstacles are reserved upfront and an obstacle added to a full set is rejected.
+     */
+    class DynamicObstacleSet
+    {
+    public:
+        /**
+         * @param slice_duration in ms
+         * @param slice_count the horizon is slice_duration * slice_count
+         * @param capacity maximal number of obstacles, 0 for no limit
+         */
+        explicit DynamicObstacleSet(float slice_duration = 100.f, int slice_count = 50, std::size_t capacity = 0);
+
+        void clear();
+
+        /**
+         * @param obstacle
+         * @return false if the set is full, the obstacle is then ignored
+         */
+        bool add(const DynamicObstacle &obstacle);
+        bool add(const CircularObstacle &obstacle);
+
+        const std::vector<DynamicObstacle> &getObstacles() const;
+        std::size_t getCapacity() const;
+
+        /**
+         * @return the number of obstacles rejected because the set was full, since the last clear
+         */
+        std::size_t getRejectedCount() const;
+
+        bool isColliding(const Vector2D &point, const float &time, const float &margin) const;
+
+        /**
+         * @param itinerary
+         * @param arrival_times the time at which each point of the itinerary is reached, see speed_profile
+         * @param margin
+         * @return the index of the first colliding point, or -1 if the itinerary is collision-free
+         */
+        int findFirstCollision(const std::vector<ItineraryPoint> &itinerary, const std::vector<float> &arrival_times,
+                               const float &margin) const;
+
+    private:
+        struct SliceEntry
+        {
+            Vector2D center;
+            float radius;
+            std::uint32_t obstacle;
+        };
+
+        bool isCollidingInList(const std::vector<std::uint32_t> &obstacles, const Vector2D &point,
+                               const float &time, const float &margin) const;
+
+        const float slice_duration_;
+        const int slice_count_;
+        const std::size_t capacity_;
+        std::size_t rejected_count_;
+
+        std::vector<DynamicObstacle> obstacles_;
+        std::vector<std::uint32_t> static_obstacles_;
+        std::vector<std::uint32_t> beyond_horizon_;
+        std::vector<std::vector<SliceEntry>> slices_;
+    };
+}
+
+#endif //KRAKEN_DYNAMIC_OBSTACLE_SET_H
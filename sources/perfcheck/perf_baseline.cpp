@@ -0,0 +1,159 @@
+#include "perf_baseline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+namespace kraken
+{
+    bool PerfComparison::isRegression() const
+    {
+        return slower || more_nodes || failed_request;
+    }
+
+    std::vector<PerfBaselineEntry> perf_baseline::parse(std::istream &strm, std::string &build_type)
+    {
+        std::vector<PerfBaselineEntry> entries;
+        std::string text;
+        std::size_t line_number = 0;
+        bool has_build_type = false;
+        while (std::getline(strm, text))
+        {
+            line_number++;
+            text = text.substr(0, text.find('#'));
+            std::istringstream line(text);
+            PerfBaselineEntry entry;
+            if (!(line >> entry.scenario))
+                continue;
+            std::string rest;
+            if (!has_build_type)
+            {
+                if (entry.scenario != "build" || !(line >> build_type) || line >> rest)
+                    throw std::invalid_argument("Malformed baseline file. Line " + std::to_string(line_number)
+                                                + " : expected build <build type> first.");
+                has_build_type = true;
+                continue;
+            }
+            if (!(line >> entry.request >> entry.p50_us >> entry.p99_us >> entry.nodes_expanded) || line >> rest)
+                throw std::invalid_argument("Malformed baseline file. Line " + std::to_string(line_number)
+                                            + " : expected <scenario> <request index> <p50> <p99> <nodes expanded>.");
+            entries.push_back(entry);
+        }
+        if (!has_build_type)
+            throw std::invalid_argument("Malformed baseline file. The build type is missing.");
+        return entries;
+    }
+
+    void perf_baseline::write(std::ostream &strm, const std::string &build_type,
+                              const std::vector<PerfMeasure> &measures)
+    {
+        strm << "build " << build_type << std::endl;
+        strm << "# <scenario> <request index> <p50 in us> <p99 in us> <nodes expanded>" << std::endl;
+        for (const auto &measure : measures)
+            for (std::size_t i = 0; i < measure.requests.size(); i++)
+            {
+                const auto &request = measure.requests[i];
+                strm << measure.name << " " << i << " " << request.p50_us << " " << request.p99_us << " "
+                     << request.nodes_expanded << std::endl;
+            }
+    }
+
+    PerfComparison perf_baseline::compare(const PerfBaselineEntry *baseline, const std::string &scenario,
+                                          std::size_t request, const PerfRequestMeasure &measure, float tolerance)
+    {
+        PerfComparison comparison;
+        comparison.scenario = scenario;
+        comparison.request = request;
+        comparison.failed_request = measure.failed;
+        if (baseline == nullptr)
+            return comparison;
+        comparison.has_baseline = true;
+
+        // Under the hypothesis that the median did not exceed the threshold, the number of latencies above it
+        // follows at most a binomial distribution B(n, 1/2)
+        float threshold = baseline->p50_us * (1 + tolerance);
+        std::size_t above = 0;
+        for (auto latency : measure.latencies_us)
+            above += latency > threshold ? 1 : 0;
+        comparison.sign_test_p = getBinomialTail(measure.latencies_us.size(), above);
+        comparison.median_ratio = baseline->p50_us > 0 ? static_cast<float>(measure.p50_us) / baseline->p50_us : 0;
+
+        comparison.more_nodes = measure.nodes_expanded > baseline->nodes_expanded * (1 + tolerance);
+        comparison.slower_tail = measure.p99_us > baseline->p99_us * (1 + 2 * tolerance);
+        return comparison;
+    }
+
+    std::vector<PerfComparison> perf_baseline::compare(const std::vector<PerfBaselineEntry> &baseline,
+                                                       const std::vector<PerfMeasure> &measures, float tolerance,
+                                                       double false_alarm_rate)
+    {
+        std::vector<PerfComparison> comparisons;
+        for (const auto &measure : measures)
+            for (std::size_t i = 0; i < measure.requests.size(); i++)
+            {
+                auto entry = std::find_if(baseline.begin(), baseline.end(), [&](const PerfBaselineEntry &candidate) {
+                    return candidate.scenario == measure.name && candidate.request == i;
+                });
+                comparisons.push_back(compare(entry == baseline.end() ? nullptr : &*entry, measure.name, i,
+                                              measure.requests[i], tolerance));
+            }
+        correct(comparisons, false_alarm_rate);
+        return comparisons;
+    }
+
+    void perf_baseline::correct(std::vector<PerfComparison> &comparisons, double false_alarm_rate)
+    {
+        std::vector<PerfComparison *> tested;
+        for (auto &comparison : comparisons)
+        {
+            comparison.slower = false;
+            if (comparison.has_baseline)
+                tested.push_back(&comparison);
+        }
+        std::stable_sort(tested.begin(), tested.end(), [](const PerfComparison *lhs, const PerfComparison *rhs) {
+            return lhs->sign_test_p < rhs->sign_test_p;
+        });
+
+        // The k-th smallest p-value is compared to rate / (m - k), until the first one that isn't significant
+        for (std::size_t k = 0; k < tested.size(); k++)
+        {
+            if (tested[k]->sign_test_p > false_alarm_rate / (tested.size() - k))
+                break;
+            tested[k]->slower = true;
+        }
+    }
+
+    double perf_baseline::getBinomialTail(std::size_t count, std::size_t successes)
+    {
+        if (successes == 0)
+            return 1;
+        if (successes > count)
+            return 0;
+
+        // Sum of C(count, i) / 2^count, each term computed in log space to support large counts
+        double tail = 0;
+        for (std::size_t i = successes; i <= count; i++)
+            tail += std::exp(std::lgamma(count + 1.) - std::lgamma(i + 1.) - std::lgamma(count - i + 1.)
+                             - count * std::log(2.));
+        return std::min(tail, 1.);
+    }
+
+    std::ostream &operator<<(std::ostream &strm, const PerfComparison &comparison)
+    {
+        strm << comparison.scenario << " #" << comparison.request << ": ";
+        if (!comparison.has_baseline)
+            strm << "no baseline";
+        else
+            strm << "median x" << comparison.median_ratio << " (sign test p=" << comparison.sign_test_p << ")";
+        if (comparison.slower)
+            strm << ", SLOWER";
+        if (comparison.more_nodes)
+            strm << ", MORE NODES";
+        if (comparison.failed_request)
+            strm << ", FAILED";
+        if (comparison.slower_tail)
+            strm << ", slower p99";
+        return strm << std::endl;
+    }
+}
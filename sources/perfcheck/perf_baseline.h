@@ -0,0 +1,109 @@
+#ifndef KRAKEN_PERF_BASELINE_H
+#define KRAKEN_PERF_BASELINE_H
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "perf_scenario.h"
+
+namespace kraken
+{
+    /*
+     * The reference measures of a request of a scenario. Text format, '#' starts a comment : the build type of the
+     * measures first, then one request per line
+     *   build <CMAKE_BUILD_TYPE>
+     *   <scenario> <request index> <p50 in us> <p99 in us> <nodes expanded>
+     */
+    struct PerfBaselineEntry
+    {
+        std::string scenario;
+        std::size_t request = 0;
+        std::uint32_t p50_us = 0;
+        std::uint32_t p99_us = 0;
+        std::uint64_t nodes_expanded = 0;
+    };
+
+    struct PerfComparison
+    {
+        std::string scenario;
+        std::size_t request = 0;
+        bool has_baseline = false;
+        //Ratio of the measured median to the baseline one
+        float median_ratio = 0;
+        //One-sided sign test : probability of at least as many latencies above the tolerated median if it was not
+        //exceeded
+        double sign_test_p = 1;
+
+        //Regressions
+        bool slower = false;
+        bool more_nodes = false;
+        //The request did not succeed
+        bool failed_request = false;
+
+        //Warning only : the tail is too noisy on a shared machine to fail a check
+        bool slower_tail = false;
+
+        bool isRegression() const;
+    };
+
+    namespace perf_baseline
+    {
+        /**
+         * Throws std::invalid_argument on a malformed line, or if the build type is missing
+         * @param strm
+         * @param build_type output, the build type of the measures
+         * @return
+         */
+        std::vector<PerfBaselineEntry> parse(std::istream &strm, std::string &build_type);
+
+        void write(std::ostream &strm, const std::string &build_type, const std::vector<PerfMeasure> &measures);
+
+        /**
+         * Computes the sign test of a request : its median is slower if significantly more than half of the
+         * latencies exceed the baseline median increased by the tolerance. Doesn't decide whether it is slower, see
+         * correct. The node count is deterministic : it only has to stay within the tolerance.
+         * @param baseline null if the request has no baseline
+         * @param scenario
+         * @param request index of the request in the scenario
+         * @param measure
+         * @param tolerance relative, e.g. 0.1 for 10%
+         * @return
+         */
+        PerfComparison compare(const PerfBaselineEntry *baseline, const std::string &scenario, std::size_t request,
+                               const PerfRequestMeasure &measure, float tolerance);
+
+        /**
+         * Compares every request of the measures with its baseline, then applies correct
+         * @param baseline
+         * @param measures
+         * @param tolerance relative, e.g. 0.1 for 10%
+         * @param false_alarm_rate of the whole check
+         * @return one comparison per request
+         */
+        std::vector<PerfComparison> compare(const std::vector<PerfBaselineEntry> &baseline,
+                                            const std::vector<PerfMeasure> &measures, float tolerance,
+                                            double false_alarm_rate = 0.01);
+
+        /**
+         * Decides which requests are slower with the Holm-Bonferroni method, so that the probability of a false
+         * alarm among all the sign tests stays below the rate
+         * @param comparisons
+         * @param false_alarm_rate e.g. 0.01
+         */
+        void correct(std::vector<PerfComparison> &comparisons, double false_alarm_rate);
+
+        /**
+         * @param count number of trials with a probability of 1/2
+         * @param successes
+         * @return the probability of at least successes successes
+         */
+        double getBinomialTail(std::size_t count, std::size_t successes);
+    }
+
+    std::ostream &operator<<(std::ostream &strm, const PerfComparison &comparison);
+}
+
+#endif //KRAKEN_PERF_BASELINE_H
@@ -0,0 +1,186 @@
+#include "perf_scenario.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+#include "../configuration/configuration_handler.h"
+#include "../instrumentation/search_statistics.h"
+#include "../navmesh/navmesh.h"
+#include "../navmesh/polygon_file.h"
+#include "../planner/planner_service.h"
+
+namespace kraken
+{
+    namespace
+    {
+        std::vector<float> readNumbers(std::istringstream &line, const std::string &keyword, std::size_t line_number)
+        {
+            std::vector<float> numbers;
+            float number;
+            while (line >> number)
+                numbers.push_back(number);
+            if (!line.eof())
+                throw std::invalid_argument("Malformed scenario file. Line " + std::to_string(line_number)
+                                            + " : unexpected value after " + keyword + ".");
+            return numbers;
+        }
+    }
+
+    std::vector<PerfScenario> perf_scenario::parse(std::istream &strm)
+    {
+        std::vector<PerfScenario> scenarios;
+        std::string text;
+        std::size_t line_number = 0;
+        while (std::getline(strm, text))
+        {
+            line_number++;
+            text = text.substr(0, text.find('#'));
+            std::istringstream line(text);
+            std::string keyword;
+            if (!(line >> keyword))
+                continue;
+
+            if (keyword == "scenario")
+            {
+                scenarios.emplace_back();
+                if (!(line >> scenarios.back().name))
+                    throw std::invalid_argument("Malformed scenario file. Line " + std::to_string(line_number)
+                                                + " : the scenario has no name.");
+                continue;
+            }
+            if (scenarios.empty())
+                throw std::invalid_argument("Malformed scenario file. Line " + std::to_string(line_number)
+                                            + " : " + keyword + " before the first scenario.");
+            auto &scenario = scenarios.back();
+
+            if (keyword == "config")
+            {
+                std::string assignment;
+                line >> assignment;
+                if (assignment.find('=') == std::string::npos)
+                    throw std::invalid_argument("Malformed scenario file. Line " + std::to_string(line_number)
+                                                + " : expected config <key>=<value>.");
+                scenario.configuration.push_back(assignment);
+                continue;
+            }
+
+            auto numbers = readNumbers(line, keyword, line_number);
+            bool valid;
+            if (keyword == "table")
+            {
+                valid = numbers.size() == 4;
+                if (valid)
+                {
+                    scenario.has_table = true;
+                    scenario.bottom_left = Vector2D(numbers[0], numbers[1]);
+                    scenario.top_right = Vector2D(numbers[2], numbers[3]);
+                }
+            }
+            else if (keyword == "polygon")
+            {
+                std::vector<Vector2D> polygon;
+                valid = polygon_file::toPolygon(numbers, polygon);
+                if (valid)
+                    scenario.polygons.push_back(std::move(polygon));
+            }
+            else if (keyword == "circle")
+            {
+                valid = numbers.size() == 3;
+                if (valid)
+                    scenario.circles.emplace_back(Vector2D(numbers[0], numbers[1]), numbers[2]);
+            }
+            else if (keyword == "request")
+            {
+                valid = numbers.size() == 6;
+                if (valid)
+                    scenario.requests.emplace_back(Kinematic(numbers[0], numbers[1], numbers[2]),
+                                                   Kinematic(numbers[3], numbers[4], numbers[5]));
+            }
+            else
+                throw std::invalid_argument("Malformed scenario file. Line " + std::to_string(line_number)
+                                            + " : unknown statement " + keyword + ".");
+            if (!valid)
+                throw std::invalid_argument("Malformed scenario file. Line " + std::to_string(line_number)
+                                            + " : wrong number of values for " + keyword + ".");
+        }
+
+        for (const auto &scenario : scenarios)
+            if (!scenario.polygons.empty() && !scenario.has_table)
+                throw std::invalid_argument("Malformed scenario file. The scenario " + scenario.name
+                                            + " has polygons but no table.");
+        return scenarios;
+    }
+
+    PerfMeasure perf_scenario::run(const PerfScenario &scenario, int repetitions)
+    {
+        // The cache would turn the repetitions into lookups
+        std::string configuration = "[default]\nEnableDebug=false\nPlanCacheSize=0\n";
+        for (const auto &assignment : scenario.configuration)
+            configuration += assignment + "\n";
+        ConfigurationHandler handler;
+        handler.loadFromString(configuration);
+        std::ostringstream statistics_stream;
+        PlannerService service(handler, statistics_stream);
+
+        if (scenario.has_table)
+        {
+            auto navmesh = std::make_shared<Navmesh>(scenario.bottom_left, scenario.top_right);
+            for (const auto &polygon : scenario.polygons)
+                navmesh->addPolygon(polygon);
+            service.setNavmesh(std::move(navmesh));
+        }
+        auto obstacles = service.createObstacleSet();
+        for (const auto &circle : scenario.circles)
+            obstacles.add(circle);
+
+        PerfMeasure measure;
+        measure.name = scenario.name;
+        measure.requests.resize(scenario.requests.size());
+        auto context = service.createContext();
+        std::vector<ItineraryPoint> itinerary;
+        for (int repetition = -1; repetition < repetitions; repetition++)
+        {
+            for (std::size_t i = 0; i < scenario.requests.size(); i++)
+            {
+                const auto &request = scenario.requests[i];
+                auto &request_measure = measure.requests[i];
+                auto begin = std::chrono::steady_clock::now();
+                auto status = context->plan(request.first, request.second, obstacles, itinerary);
+                auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - begin);
+                request_measure.nodes_expanded = search_statistics::local().get(SearchCounter::NodesExpanded);
+                request_measure.failed = status != SearchStatus::Success;
+                // The first round warms up the caches and the pools
+                if (repetition >= 0)
+                    request_measure.latencies_us.push_back(static_cast<std::uint32_t>(duration.count()));
+            }
+        }
+
+        for (auto &request_measure : measure.requests)
+        {
+            auto &latencies = request_measure.latencies_us;
+            std::sort(latencies.begin(), latencies.end());
+            request_measure.p50_us = getPercentile(latencies, 50);
+            request_measure.p99_us = getPercentile(latencies, 99);
+            measure.latencies_us.insert(measure.latencies_us.end(), latencies.begin(), latencies.end());
+            measure.nodes_expanded += request_measure.nodes_expanded;
+            measure.failures += request_measure.failed ? 1 : 0;
+        }
+        std::sort(measure.latencies_us.begin(), measure.latencies_us.end());
+        measure.p50_us = getPercentile(measure.latencies_us, 50);
+        measure.p99_us = getPercentile(measure.latencies_us, 99);
+        return measure;
+    }
+
+    std::uint32_t perf_scenario::getPercentile(const std::vector<std::uint32_t> &sorted_values, float percentile)
+    {
+        if (sorted_values.empty())
+            return 0;
+        auto rank = static_cast<std::size_t>(std::ceil(percentile / 100 * sorted_values.size()));
+        return sorted_values[std::min(sorted_values.size() - 1, rank == 0 ? 0 : rank - 1)];
+    }
+}
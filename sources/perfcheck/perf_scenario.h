@@ -0,0 +1,87 @@
+#ifndef KRAKEN_PERF_SCENARIO_H
+#define KRAKEN_PERF_SCENARIO_H
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "../obstacles/circular_obstacle.h"
+#include "../struct/kinematic.h"
+
+namespace kraken
+{
+    /*
+     * A table layout and the requests planned on it by kraken_perfcheck.
+     * Text format, one statement per line, '#' starts a comment, lengths in mm and angles in rad :
+     *   scenario <name>
+     *   table <min x> <min y> <max x> <max y>       builds a navmesh of the table
+     *   polygon <x> <y> <x> <y> <x> <y> ...         fixed obstacle of the navmesh, see polygon_file.h
+     *   circle <x> <y> <radius>                     obstacle given with every request
+     *   request <x> <y> <orientation> <x> <y> <orientation>
+     *   config <key>=<value>                        overrides a configuration value
+     */
+    struct PerfScenario
+    {
+        std::string name;
+        bool has_table = false;
+        Vector2D bottom_left;
+        Vector2D top_right;
+        std::vector<std::vector<Vector2D>> polygons;
+        std::vector<CircularObstacle> circles;
+        std::vector<std::pair<Kinematic, Kinematic>> requests;
+        std::vector<std::string> configuration;
+    };
+
+    struct PerfRequestMeasure
+    {
+        //The latency of each repetition, sorted
+        std::vector<std::uint32_t> latencies_us;
+        std::uint32_t p50_us = 0;
+        std::uint32_t p99_us = 0;
+        //Deterministic
+        std::uint64_t nodes_expanded = 0;
+        bool failed = false;
+    };
+
+    struct PerfMeasure
+    {
+        std::string name;
+        //In the order of the scenario
+        std::vector<PerfRequestMeasure> requests;
+        //Every planning latency of the scenario, sorted
+        std::vector<std::uint32_t> latencies_us;
+        std::uint32_t p50_us = 0;
+        std::uint32_t p99_us = 0;
+        //Per round of requests, deterministic
+        std::uint64_t nodes_expanded = 0;
+        std::uint32_t failures = 0;
+    };
+
+    namespace perf_scenario
+    {
+        /**
+         * Throws std::invalid_argument on a malformed line
+         * @param strm
+         * @return
+         */
+        std::vector<PerfScenario> parse(std::istream &strm);
+
+        /**
+         * Plans every request of the scenario once to warm up, then repetitions times, the plan cache disabled
+         * @param scenario
+         * @param repetitions
+         * @return
+         */
+        PerfMeasure run(const PerfScenario &scenario, int repetitions);
+
+        /**
+         * @param sorted_values
+         * @param percentile in [0, 100]
+         * @return the nearest-rank percentile, 0 if there is no value
+         */
+        std::uint32_t getPercentile(const std::vector<std::uint32_t> &sorted_values, float percentile);
+    }
+}
+
+#endif //KRAKEN_PERF_SCENARIO_H
@@ -0,0 +1,141 @@
+#include "asynchronous_planner.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "planner_service.h"
+#include "../trajectory/tracking_monitor.h"
+
+namespace kraken
+{
+    namespace
+    {
+        //Heap order : urgent requests first, then the oldest
+        bool isServedAfter(const std::shared_ptr<PlanState> &lhs, const std::shared_ptr<PlanState> &rhs)
+        {
+            if (lhs->priority != rhs->priority)
+                return lhs->priority < rhs->priority;
+            return lhs->sequence > rhs->sequence;
+        }
+    }
+
+    AsynchronousPlanner::AsynchronousPlanner(PlannerService &service) : next_sequence_(0), stopping_(false)
+    {
+        auto thread_number = std::max(1, service.getSnapshot()->parameters.thread_number);
+        for (int i = 0; i < thread_number; i++)
+            contexts_.push_back(service.createContext());
+        for (auto &context : contexts_)
+            workers_.emplace_back(&AsynchronousPlanner::work, this, std::ref(*context));
+    }
+
+    AsynchronousPlanner::~AsynchronousPlanner()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            for (auto &state : running_)
+            {
+                state->cancelled.store(true);
+                state->interruption.store(true);
+            }
+        }
+        queue_condition_.notify_all();
+        for (auto &worker : workers_)
+            worker.join();
+
+        for (auto &state : queue_)
+            state->finish(SearchStatus::Cancelled);
+    }
+
+    PlanHandle AsynchronousPlanner::planAsync(const Kinematic &start, const Kinematic &goal,
+                                              const DynamicObstacleSet &obstacles, PlanPriority priority)
+    {
+        std::shared_ptr<PlanState> state;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            state = std::make_shared<PlanState>(start, goal, obstacles, priority, next_sequence_++);
+            push(state);
+            if (priority == PlanPriority::Urgent && running_.size() == workers_.size())
+                preemptBackgroundRequest();
+        }
+        queue_condition_.notify_one();
+        return PlanHandle(state);
+    }
+
+    PlanHandle AsynchronousPlanner::planRejoin(const Kinematic &state, const TrackingMonitor &monitor,
+                                               const DynamicObstacleSet &obstacles)
+    {
+        const auto &itinerary = monitor.getItinerary();
+        if (itinerary.empty())
+            throw std::invalid_argument("The tracking monitor follows no itinerary.");
+        Kinematic rejoin;
+        rejoin.update(itinerary[monitor.getRejoinPoint()]);
+        return planAsync(state, rejoin, obstacles, PlanPriority::Urgent);
+    }
+
+    void AsynchronousPlanner::work(PlanningContext &context)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true)
+        {
+            queue_condition_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (stopping_)
+                return;
+
+            std::pop_heap(queue_.begin(), queue_.end(), isServedAfter);
+            auto state = std::move(queue_.back());
+            queue_.pop_back();
+            {
+                std::lock_guard<std::mutex> state_lock(state->mutex);
+                if (!state->done && !state->cancelled.load())
+                    state->started = true;
+            }
+            if (!state->started)
+            {
+                // Cancelled while it was preempted
+                state->finish(SearchStatus::Cancelled);
+                continue;
+            }
+            running_.push_back(state);
+            lock.unlock();
+
+            auto status = context.plan(state->start, state->goal, state->obstacles, state->itinerary,
+                                       &state->interruption);
+
+            lock.lock();
+            running_.erase(std::find(running_.begin(), running_.end(), state));
+            if (status == SearchStatus::Cancelled && !state->cancelled.load() && !stopping_)
+            {
+                // Preempted : planned again later, from scratch
+                {
+                    std::lock_guard<std::mutex> state_lock(state->mutex);
+                    state->started = false;
+                }
+                state->interruption.store(false);
+                push(std::move(state));
+                continue;
+            }
+            state->finish(status);
+        }
+    }
+
+    void AsynchronousPlanner::push(std::shared_ptr<PlanState> state)
+    {
+        queue_.push_back(std::move(state));
+        std::push_heap(queue_.begin(), queue_.end(), isServedAfter);
+    }
+
+    void AsynchronousPlanner::preemptBackgroundRequest()
+    {
+        // The most recent background request has lost the least work
+        std::shared_ptr<PlanState> preempted;
+        for (const auto &state : running_)
+        {
+            if (state->priority == PlanPriority::Background && !state->interruption.load()
+                && (!preempted || state->sequence > preempted->sequence))
+                preempted = state;
+        }
+        if (preempted)
+            preempted->interruption.store(true);
+    }
+}
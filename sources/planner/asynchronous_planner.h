@@ -0,0 +1,64 @@
+#ifndef KRAKEN_ASYNCHRONOUS_PLANNER_H
+#define KRAKEN_ASYNCHRONOUS_PLANNER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "plan_handle.h"
+
+namespace kraken
+{
+    class PlannerService;
+    class TrackingMonitor;
+
+    /*
+     * Plans requests on a pool of ThreadNumber workers, each one with its own PlanningContext.
+     * Urgent requests are served first. When every worker is busy, an urgent request preempts a running background
+     * request : its search is interrupted and the request goes back to the queue, to be planned again later.
+     */
+    class AsynchronousPlanner
+    {
+    public:
+        explicit AsynchronousPlanner(PlannerService &service);
+        ~AsynchronousPlanner();
+
+        AsynchronousPlanner(const AsynchronousPlanner &) = delete;
+        AsynchronousPlanner &operator=(const AsynchronousPlanner &) = delete;
+
+        PlanHandle planAsync(const Kinematic &start, const Kinematic &goal, const DynamicObstacleSet &obstacles,
+                             PlanPriority priority = PlanPriority::Urgent);
+
+        /**
+         * Submits the partial replanning of a TrackingStatus::Replan, as an urgent request : from the current state of
+         * the robot to the rejoin point of the monitor. The followed itinerary continues after that point.
+         * Throws std::invalid_argument if the monitor follows no itinerary.
+         * @param state the current state, as given to TrackingMonitor::update
+         * @param monitor
+         * @param obstacles
+         * @return
+         */
+        PlanHandle planRejoin(const Kinematic &state, const TrackingMonitor &monitor,
+                              const DynamicObstacleSet &obstacles);
+
+    private:
+        void work(PlanningContext &context);
+        void push(std::shared_ptr<PlanState> state);
+        void preemptBackgroundRequest();
+
+        std::vector<std::unique_ptr<PlanningContext>> contexts_;
+        std::vector<std::thread> workers_;
+
+        std::mutex mutex_;
+        std::condition_variable queue_condition_;
+        std::vector<std::shared_ptr<PlanState>> queue_;
+        std::vector<std::shared_ptr<PlanState>> running_;
+        std::uint64_t next_sequence_;
+        bool stopping_;
+    };
+}
+
+#endif //KRAKEN_ASYNCHRONOUS_PLANNER_H
@@ -0,0 +1,90 @@
+#include "closed_set.h"
+
+#include <algorithm>
+
+namespace kraken
+{
+    ClosedSet::ClosedSet(std::size_t node_capacity) : mask_(0), size_(0), max_size_(0), generation_(1)
+    {
+        resize(node_capacity);
+    }
+
+    void ClosedSet::resize(std::size_t node_capacity)
+    {
+        std::size_t capacity = 16;
+        while (capacity < 4 * node_capacity)
+            capacity *= 2;
+        if (capacity != entries_.size())
+        {
+            entries_.assign(capacity, Entry{0, 0, 0});
+            entries_.shrink_to_fit();
+            generation_ = 1;
+        }
+        else
+            clear();
+        mask_ = capacity - 1;
+        max_size_ = capacity / 4 * 3;
+        size_ = 0;
+    }
+
+    void ClosedSet::clear()
+    {
+        size_ = 0;
+        if (++generation_ != 0)
+            return;
+
+        // Once in 2^32 clears, the stamps of the previous generations would become current again
+        for (auto &entry : entries_)
+            entry.generation = 0;
+        generation_ = 1;
+    }
+
+    bool ClosedSet::find(std::uint64_t key, float &cost) const
+    {
+        const auto &entry = entries_[findEntry(key)];
+        if (entry.generation != generation_)
+            return false;
+        cost = entry.cost;
+        return true;
+    }
+
+    bool ClosedSet::insert(std::uint64_t key, float cost)
+    {
+        auto &entry = entries_[findEntry(key)];
+        if (entry.generation != generation_)
+        {
+            if (size_ == max_size_)
+                return false;
+            size_++;
+            entry.key = key;
+            entry.generation = generation_;
+        }
+        entry.cost = cost;
+        return true;
+    }
+
+    std::size_t ClosedSet::getSize() const
+    {
+        return size_;
+    }
+
+    std::size_t ClosedSet::getCapacity() const
+    {
+        return entries_.size();
+    }
+
+    std::size_t ClosedSet::findEntry(std::uint64_t key) const
+    {
+        // The keys pack the cell, orientation and curvature of a state : their bits are mixed before the masking
+        std::uint64_t hash = key;
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+
+        // Linear probing, an empty entry always exists below the maximal load
+        auto index = static_cast<std::size_t>(hash) & mask_;
+        while (entries_[index].generation == generation_ && entries_[index].key != key)
+            index = (index + 1) & mask_;
+        return index;
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef KRAKEN_CLOSED_SET_H
+#define KRAKEN_CLOSED_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace kraken
+{
+    /*
+     * Lowest cost reached for each discretized state of a search. Open-addressing table, allocated once for four times
+     * the node pool, since a search records the states of the pruned children too : a search never allocates.
+     * Clearing only increments the generation the entries are stamped with.
+     * Past three quarters of the table, new states are no longer recorded : the search then only expands some
+     * duplicates.
+     */
+    class ClosedSet
+    {
+    public:
+        /**
+         * @param node_capacity capacity of the node pool
+         */
+        explicit ClosedSet(std::size_t node_capacity);
+
+        void resize(std::size_t node_capacity);
+        void clear();
+
+        /**
+         * @param key
+         * @param cost output, the cost recorded for the state
+         * @return false if the state is not recorded
+         */
+        bool find(std::uint64_t key, float &cost) const;
+
+        /**
+         * Records the cost of a state, replacing the previous one
+         * @param key
+         * @param cost
+         * @return false if the table is full and the state was not recorded yet
+         */
+        bool insert(std::uint64_t key, float cost);
+
+        std::size_t getSize() const;
+        std::size_t getCapacity() const;
+
+    private:
+        struct Entry
+        {
+            std::uint64_t key;
+            float cost;
+            //The entry is empty unless it is the current generation
+            std::uint32_t generation;
+        };
+
+        /**
+         * @return the entry of the key, or the empty entry where it would be inserted
+         */
+        std::size_t findEntry(std::uint64_t key) const;
+
+        std::vector<Entry> entries_;
+        std::size_t mask_;
+        std::size_t size_;
+        std::size_t max_size_;
+        std::uint32_t generation_;
+    };
+}
+
+#endif //KRAKEN_CLOSED_SET_H
@@ -0,0 +1,86 @@
+#include "goal_evaluator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "asynchronous_planner.h"
+#include "planner_service.h"
+#include "../instrumentation/search_statistics.h"
+
+namespace kraken
+{
+    GoalEvaluator::GoalEvaluator(PlannerService &service) : service_(service)
+    {
+
+    }
+
+    void GoalEvaluator::estimate(const Kinematic &start, const std::vector<Kinematic> &goals,
+                                 std::vector<GoalEstimate> &estimates)
+    {
+        auto snapshot = service_.getSnapshot();
+        float max_speed = RuntimeRobotModel(*snapshot).getMaxSpeed();
+
+        goal_positions_.clear();
+        for (const auto &goal : goals)
+            goal_positions_.push_back(goal.getPosition());
+        if (snapshot->navmesh)
+        {
+            ScopedPhaseTimer timer(PlanningPhase::HeuristicBuild);
+            navmesh_query_.findPathLengths(*snapshot->navmesh, start.getPosition(), goal_positions_, lengths_);
+        }
+        else
+        {
+            lengths_.clear();
+            for (const auto &position : goal_positions_)
+                lengths_.push_back(start.getPosition().distance(position));
+        }
+
+        estimates.assign(goals.size(), GoalEstimate());
+        for (std::size_t i = 0; i < goals.size(); i++)
+            estimates[i].travel_time = lengths_[i] / max_speed;
+    }
+
+    void GoalEvaluator::refine(AsynchronousPlanner &planner, const Kinematic &start,
+                               const std::vector<Kinematic> &goals, const DynamicObstacleSet &obstacles,
+                               std::size_t count, std::vector<GoalEstimate> &estimates)
+    {
+        order_.clear();
+        for (std::size_t i = 0; i < estimates.size(); i++)
+        {
+            if (!std::isinf(estimates[i].travel_time))
+                order_.push_back(i);
+        }
+        count = std::min(count, order_.size());
+        std::partial_sort(order_.begin(), order_.begin() + count, order_.end(),
+                          [&estimates](std::size_t lhs, std::size_t rhs) {
+                              return estimates[lhs].travel_time < estimates[rhs].travel_time;
+                          });
+
+        // Every search is queued before waiting for the first one, so they run in parallel
+        std::vector<PlanHandle> handles;
+        handles.reserve(count);
+        for (std::size_t i = 0; i < count; i++)
+            handles.push_back(planner.planAsync(start, goals[order_[i]], obstacles, PlanPriority::Background));
+
+        float minimal_speed = service_.getSnapshot()->parameters.minimal_speed;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            auto &estimate = estimates[order_[i]];
+            estimate.refined = true;
+            estimate.status = handles[i].getStatus();
+            const auto &itinerary = handles[i].getItinerary();
+            // A search stopped early, e.g. on a timeout, keeps the lower bound
+            if (estimate.status == SearchStatus::NoPath)
+                estimate.travel_time = std::numeric_limits<float>::infinity();
+            if (estimate.status != SearchStatus::Success)
+                continue;
+            if (!itinerary.empty())
+            {
+                speed_profile::computeArrivalTimes(itinerary, 0, minimal_speed, arrival_times_);
+                estimate.travel_time = arrival_times_.back();
+            }
+            else
+                estimate.travel_time = 0;
+        }
+    }
+}
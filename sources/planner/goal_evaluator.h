@@ -0,0 +1,67 @@
+#ifndef KRAKEN_GOAL_EVALUATOR_H
+#define KRAKEN_GOAL_EVALUATOR_H
+
+#include <limits>
+#include <vector>
+
+#include "planning_context.h"
+#include "../navmesh/navmesh_query.h"
+
+namespace kraken
+{
+    class AsynchronousPlanner;
+    class PlannerService;
+
+    struct GoalEstimate
+    {
+        //In ms, infinity if the goal cannot be reached
+        float travel_time = std::numeric_limits<float>::infinity();
+        //Planned with the full kinematic search, status is then the status of that search
+        bool refined = false;
+        SearchStatus status = SearchStatus::NoPath;
+    };
+
+    /*
+     * Travel time estimates from the current position to many goals at once, e.g. the targets of the strategy.
+     * A single shortest path query in the navmesh serves every goal ; the estimate is the length of the taut path
+     * at the maximal speed, a lower bound of the travel time. The best goals can then be refined with the full
+     * search on the workers of an AsynchronousPlanner.
+     * The buffers are kept between the queries. Use one evaluator per thread.
+     */
+    class GoalEvaluator
+    {
+    public:
+        explicit GoalEvaluator(PlannerService &service);
+
+        /**
+         * @param start
+         * @param goals
+         * @param estimates output, one per goal in the same order, not refined
+         */
+        void estimate(const Kinematic &start, const std::vector<Kinematic> &goals,
+                      std::vector<GoalEstimate> &estimates);
+
+        /**
+         * Plans the reachable goals with the lowest estimates as background requests, and replaces their estimates
+         * with the arrival time of the itinerary, or infinity if there is no path. Waits for the searches.
+         * @param planner
+         * @param start
+         * @param goals
+         * @param obstacles
+         * @param count maximal number of goals to refine
+         * @param estimates input and output, computed by estimate for the same goals
+         */
+        void refine(AsynchronousPlanner &planner, const Kinematic &start, const std::vector<Kinematic> &goals,
+                    const DynamicObstacleSet &obstacles, std::size_t count, std::vector<GoalEstimate> &estimates);
+
+    private:
+        PlannerService &service_;
+        NavmeshQuery navmesh_query_;
+        std::vector<Vector2D> goal_positions_;
+        std::vector<float> lengths_;
+        std::vector<std::size_t> order_;
+        std::vector<float> arrival_times_;
+    };
+}
+
+#endif //KRAKEN_GOAL_EVALUATOR_H
@@ -0,0 +1,66 @@
+#include "node_pool.h"
+
+namespace kraken
+{
+    NodePool::NodePool(std::size_t capacity) : nodes_(capacity), used_(0), high_water_mark_(0)
+    {
+        free_nodes_.reserve(capacity);
+    }
+
+    SearchNode *NodePool::allocate()
+    {
+        SearchNode *node;
+        if (!free_nodes_.empty())
+        {
+            node = free_nodes_.back();
+            free_nodes_.pop_back();
+        }
+        else if (used_ + free_nodes_.size() < nodes_.size())
+            node = &nodes_[used_ + free_nodes_.size()];
+        else
+            return nullptr;
+
+        used_++;
+        if (used_ > high_water_mark_)
+            high_water_mark_ = used_;
+        return node;
+    }
+
+    void NodePool::release(SearchNode *node)
+    {
+        free_nodes_.push_back(node);
+        used_--;
+    }
+
+    void NodePool::reset()
+    {
+        free_nodes_.clear();
+        used_ = 0;
+        high_water_mark_ = 0;
+    }
+
+    void NodePool::resize(std::size_t capacity)
+    {
+        // The nodes are released, the vector is shrunk as the pool size is the main memory lever
+        std::vector<SearchNode>(capacity).swap(nodes_);
+        std::vector<SearchNode *>().swap(free_nodes_);
+        free_nodes_.reserve(capacity);
+        used_ = 0;
+        high_water_mark_ = 0;
+    }
+
+    std::size_t NodePool::getUsed() const
+    {
+        return used_;
+    }
+
+    std::size_t NodePool::getCapacity() const
+    {
+        return nodes_.size();
+    }
+
+    std::size_t NodePool::getHighWaterMark() const
+    {
+        return high_water_mark_;
+    }
+}
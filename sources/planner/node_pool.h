@@ -0,0 +1,50 @@
+#ifndef KRAKEN_NODE_POOL_H
+#define KRAKEN_NODE_POOL_H
+
+#include <cstddef>
+#include <vector>
+
+#include "search_node.h"
+
+namespace kraken
+{
+    /*
+     * Fixed-size pool of search nodes, allocated once (NodeMemoryPoolSize). A search never allocates a node on the heap.
+     * Released nodes, e.g. open nodes pruned when the pool is exhausted, are kept in a free list and reused first.
+     */
+    class NodePool
+    {
+    public:
+        explicit NodePool(std::size_t capacity);
+
+        /**
+         * @return a node, or nullptr if the pool is exhausted
+         */
+        SearchNode *allocate();
+
+        /**
+         * Gives back a node no other node points to, e.g. a node discarded right after its generation
+         * @param node
+         */
+        void release(SearchNode *node);
+        void reset();
+        void resize(std::size_t capacity);
+
+        std::size_t getUsed() const;
+        std::size_t getCapacity() const;
+
+        /**
+         * @return the largest number of nodes used at once since the last reset
+         */
+        std::size_t getHighWaterMark() const;
+
+    private:
+        std::vector<SearchNode> nodes_;
+        //Sized to the capacity, so that releasing never allocates
+        std::vector<SearchNode *> free_nodes_;
+        std::size_t used_;
+        std::size_t high_water_mark_;
+    };
+}
+
+#endif //KRAKEN_NODE_POOL_H
@@ -0,0 +1,179 @@
+#include "plan_cache.h"
+
+#include <cmath>
+
+#include "../trajectory/speed_profile.h"
+
+namespace kraken
+{
+    PlanCache::PlanCache(std::size_t capacity, float squared_delta_position, float delta_curvature,
+                         float delta_orientation, bool use_symmetry) :
+            capacity_(capacity), squared_delta_position_(squared_delta_position), delta_curvature_(delta_curvature),
+            delta_orientation_(delta_orientation), use_symmetry_(use_symmetry)
+    {
+
+    }
+
+    bool PlanCache::find(const Kinematic &start, const Kinematic &goal, const DynamicObstacleSet &obstacles,
+                         const float &margin, const float &minimal_speed, std::vector<ItineraryPoint> &itinerary)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (int mirrored = 0; mirrored < (use_symmetry_ ? 2 : 1); mirrored++)
+        {
+            Kinematic cached_start(start), cached_goal(goal);
+            cached_start.Ysym(mirrored != 0);
+            cached_goal.Ysym(mirrored != 0);
+
+            auto entry = findSimilar(cached_start, cached_goal);
+            if (entry == entries_.end())
+                continue;
+
+            if (!isStillValid(entry->itinerary, mirrored != 0, obstacles, margin, minimal_speed))
+            {
+                erase(entry);
+                continue;
+            }
+
+            // ItineraryPoint is not assignable, the points are copy-constructed
+            entries_.splice(entries_.begin(), entries_, entry);
+            const auto &found = mirrored ? mirrored_ : entry->itinerary;
+            itinerary.clear();
+            itinerary.reserve(found.size());
+            for (const auto &point : found)
+                itinerary.push_back(point);
+            return true;
+        }
+        return false;
+    }
+
+    void PlanCache::insert(const Kinematic &start, const Kinematic &goal, const std::vector<ItineraryPoint> &itinerary)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (capacity_ == 0)
+            return;
+
+        auto previous = findSimilar(start, goal);
+        if (previous != entries_.end())
+            erase(previous);
+        while (entries_.size() >= capacity_)
+            erase(std::prev(entries_.end()));
+
+        std::int64_t cells[4], neighbour_cells[4];
+        getCells(start, goal, cells, neighbour_cells);
+        auto key = getKey(cells, start.getGoingForward(), start.getStop());
+        entries_.push_front({key, start, goal, itinerary});
+        index_.emplace(key, entries_.begin());
+    }
+
+    void PlanCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+        index_.clear();
+    }
+
+    void PlanCache::resize(std::size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_ = capacity;
+        while (entries_.size() > capacity_)
+            erase(std::prev(entries_.end()));
+    }
+
+    std::size_t PlanCache::size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+    std::uint64_t PlanCache::getKey(const std::int64_t cells[4], bool going_forward, bool stop) const
+    {
+        std::uint64_t key = 0;
+        for (int i = 0; i < 4; i++)
+            key = key * 1000003 + static_cast<std::uint64_t>(cells[i]);
+        return key * 4 + (going_forward ? 2 : 0) + (stop ? 1 : 0);
+    }
+
+    void PlanCache::getCells(const Kinematic &start, const Kinematic &goal, std::int64_t cells[4],
+                             std::int64_t neighbour_cells[4]) const
+    {
+        // The cells are twice as large as the position tolerance : a similar position is either in the same cell or
+        // in the neighbour cell on the side of the nearest border
+        float delta_position = std::sqrt(squared_delta_position_);
+        float cell_size = 2 * delta_position;
+        const float coordinates[4] = {start.getPosition().getX(), start.getPosition().getY(),
+                                      goal.getPosition().getX(), goal.getPosition().getY()};
+        for (int i = 0; i < 4; i++)
+        {
+            float cell = std::floor(coordinates[i] / cell_size);
+            float offset = coordinates[i] - cell * cell_size;
+            cells[i] = static_cast<std::int64_t>(cell);
+            if (offset < delta_position)
+                neighbour_cells[i] = cells[i] - 1;
+            else if (offset > cell_size - delta_position)
+                neighbour_cells[i] = cells[i] + 1;
+            else
+                neighbour_cells[i] = cells[i];
+        }
+    }
+
+    PlanCache::EntryList::iterator PlanCache::findSimilar(const Kinematic &start, const Kinematic &goal)
+    {
+        std::int64_t cells[4], neighbour_cells[4], probed_cells[4];
+        getCells(start, goal, cells, neighbour_cells);
+
+        for (int combination = 0; combination < 16; combination++)
+        {
+            bool duplicate = false;
+            for (int i = 0; i < 4; i++)
+            {
+                bool neighbour = (combination >> i) & 1;
+                duplicate |= neighbour && neighbour_cells[i] == cells[i];
+                probed_cells[i] = neighbour ? neighbour_cells[i] : cells[i];
+            }
+            if (duplicate)
+                continue;
+
+            auto range = index_.equal_range(getKey(probed_cells, start.getGoingForward(), start.getStop()));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                auto entry = it->second;
+                if (entry->start.isSimilar(start, squared_delta_position_, delta_curvature_, delta_orientation_)
+                    && entry->goal.getPosition().squaredDistance(goal.getPosition()) < squared_delta_position_)
+                    return entry;
+            }
+        }
+        return entries_.end();
+    }
+
+    bool PlanCache::isStillValid(const std::vector<ItineraryPoint> &itinerary, bool mirrored,
+                                 const DynamicObstacleSet &obstacles, const float &margin, const float &minimal_speed)
+    {
+        const std::vector<ItineraryPoint> *checked = &itinerary;
+        if (mirrored)
+        {
+            mirrored_.clear();
+            for (const auto &point : itinerary)
+                mirrored_.push_back(point.getYsym());
+            checked = &mirrored_;
+        }
+
+        speed_profile::computeArrivalTimes(*checked, 0, minimal_speed, arrival_times_);
+        return obstacles.findFirstCollision(*checked, arrival_times_, margin) < 0;
+    }
+
+    void PlanCache::erase(EntryList::iterator entry)
+    {
+        auto range = index_.equal_range(entry->key);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == entry)
+            {
+                index_.erase(it);
+                break;
+            }
+        }
+        entries_.erase(entry);
+    }
+}
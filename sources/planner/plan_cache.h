@@ -0,0 +1,81 @@
+#ifndef KRAKEN_PLAN_CACHE_H
+#define KRAKEN_PLAN_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "../obstacles/dynamic_obstacle_set.h"
+#include "../struct/kinematic.h"
+
+namespace kraken
+{
+    /*
+     * LRU cache of the last itineraries, shared by the planning contexts.
+     * An entry is found when its start and goal are similar (Kinematic::isSimilar) to the requested ones ; the
+     * positions are quantized with the same tolerance to index the entries. A found itinerary is only returned if it
+     * is still collision-free with the current obstacles, otherwise it is evicted. With the symmetry enabled, the
+     * itinerary planned for one team colour is also used, mirrored, for the other one.
+     */
+    class PlanCache
+    {
+    public:
+        /**
+         * @param capacity
+         * @param squared_delta_position in mm^2
+         * @param delta_curvature in m^-1
+         * @param delta_orientation in rad
+         * @param use_symmetry
+         */
+        explicit PlanCache(std::size_t capacity, float squared_delta_position = 100.f, float delta_curvature = 0.2f,
+                           float delta_orientation = 0.05f, bool use_symmetry = true);
+
+        /**
+         * @param itinerary output, only modified if a valid itinerary is found
+         * @return true if a valid itinerary was found
+         */
+        bool find(const Kinematic &start, const Kinematic &goal, const DynamicObstacleSet &obstacles,
+                  const float &margin, const float &minimal_speed, std::vector<ItineraryPoint> &itinerary);
+
+        void insert(const Kinematic &start, const Kinematic &goal, const std::vector<ItineraryPoint> &itinerary);
+
+        void clear();
+        void resize(std::size_t capacity);
+        std::size_t size() const;
+
+    private:
+        struct Entry
+        {
+            std::uint64_t key;
+            Kinematic start;
+            Kinematic goal;
+            std::vector<ItineraryPoint> itinerary;
+        };
+        using EntryList = std::list<Entry>;
+
+        std::uint64_t getKey(const std::int64_t cells[4], bool going_forward, bool stop) const;
+        void getCells(const Kinematic &start, const Kinematic &goal, std::int64_t cells[4],
+                      std::int64_t neighbour_cells[4]) const;
+        EntryList::iterator findSimilar(const Kinematic &start, const Kinematic &goal);
+        bool isStillValid(const std::vector<ItineraryPoint> &itinerary, bool mirrored,
+                          const DynamicObstacleSet &obstacles, const float &margin, const float &minimal_speed);
+        void erase(EntryList::iterator entry);
+
+        std::size_t capacity_;
+        const float squared_delta_position_;
+        const float delta_curvature_;
+        const float delta_orientation_;
+        const bool use_symmetry_;
+
+        mutable std::mutex mutex_;
+        //Most recently used first
+        EntryList entries_;
+        std::unordered_multimap<std::uint64_t, EntryList::iterator> index_;
+        std::vector<float> arrival_times_;
+        std::vector<ItineraryPoint> mirrored_;
+    };
+}
+
+#endif //KRAKEN_PLAN_CACHE_H
@@ -0,0 +1,90 @@
+#include "plan_handle.h"
+
+#include <cassert>
+
+namespace kraken
+{
+    PlanState::PlanState(const Kinematic &start, const Kinematic &goal, const DynamicObstacleSet &obstacles,
+                         PlanPriority priority, std::uint64_t sequence) :
+            start(start), goal(goal), obstacles(obstacles), priority(priority), sequence(sequence), cancelled(false),
+            interruption(false)
+    {
+
+    }
+
+    bool PlanState::finish(SearchStatus final_status)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (done)
+                return false;
+            done = true;
+            status = final_status;
+        }
+        done_condition.notify_all();
+        return true;
+    }
+
+    PlanHandle::PlanHandle(std::shared_ptr<PlanState> state) : state_(std::move(state))
+    {
+
+    }
+
+    void PlanHandle::cancel()
+    {
+        if (!isValid())
+            return;
+        state_->cancelled.store(true);
+        state_->interruption.store(true);
+
+        {
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            // A running request is finished by its worker
+            if (state_->started || state_->done)
+                return;
+            state_->done = true;
+            state_->status = SearchStatus::Cancelled;
+        }
+        state_->done_condition.notify_all();
+    }
+
+    bool PlanHandle::isValid() const
+    {
+        return state_ != nullptr;
+    }
+
+    bool PlanHandle::isReady() const
+    {
+        assert(isValid());
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        return state_->done;
+    }
+
+    void PlanHandle::wait() const
+    {
+        assert(isValid());
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        state_->done_condition.wait(lock, [this] { return state_->done; });
+    }
+
+    bool PlanHandle::waitFor(const std::chrono::milliseconds &timeout) const
+    {
+        assert(isValid());
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        return state_->done_condition.wait_for(lock, timeout, [this] { return state_->done; });
+    }
+
+    SearchStatus PlanHandle::getStatus() const
+    {
+        assert(isValid());
+        wait();
+        return state_->status;
+    }
+
+    const std::vector<ItineraryPoint> &PlanHandle::getItinerary() const
+    {
+        assert(isValid());
+        wait();
+        return state_->itinerary;
+    }
+}
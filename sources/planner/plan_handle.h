@@ -0,0 +1,95 @@
+#ifndef KRAKEN_PLAN_HANDLE_H
+#define KRAKEN_PLAN_HANDLE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "planning_context.h"
+
+namespace kraken
+{
+    namespace PlanPriorities {
+        enum class PlanPriorities {
+            Background = 0,     //What-if queries, preempted by urgent requests
+            Urgent              //Replanning of the current trajectory
+        };
+    }
+    using PlanPriority = PlanPriorities::PlanPriorities;
+
+    /*
+     * State of an asynchronous planning request, shared by the AsynchronousPlanner and the PlanHandle.
+     */
+    struct PlanState
+    {
+        PlanState(const Kinematic &start, const Kinematic &goal, const DynamicObstacleSet &obstacles,
+                  PlanPriority priority, std::uint64_t sequence);
+
+        const Kinematic start;
+        const Kinematic goal;
+        const DynamicObstacleSet obstacles;
+        const PlanPriority priority;
+        const std::uint64_t sequence;
+
+        //Set by the caller
+        std::atomic<bool> cancelled;
+        //Stops the search, either cancelled or preempted
+        std::atomic<bool> interruption;
+
+        std::mutex mutex;
+        std::condition_variable done_condition;
+        bool started = false;
+        bool done = false;
+        SearchStatus status = SearchStatus::Cancelled;
+        std::vector<ItineraryPoint> itinerary;
+
+        /**
+         * @return false if the request was already done
+         */
+        bool finish(SearchStatus final_status);
+    };
+
+    /*
+     * Future-like handle on an asynchronous planning request. A default-constructed handle refers to no request : only
+     * isValid and cancel may be called on it.
+     */
+    class PlanHandle
+    {
+    public:
+        PlanHandle() = default;
+        explicit PlanHandle(std::shared_ptr<PlanState> state);
+
+        /**
+         * Stops the request. A pending request is done immediately, a running one after its current node expansion.
+         * Does nothing on an invalid handle.
+         */
+        void cancel();
+
+        bool isValid() const;
+
+        //The following methods require a valid handle
+
+        bool isReady() const;
+        void wait() const;
+        bool waitFor(const std::chrono::milliseconds &timeout) const;
+
+        /**
+         * Waits for the end of the request
+         */
+        SearchStatus getStatus() const;
+
+        /**
+         * Waits for the end of the request
+         */
+        const std::vector<ItineraryPoint> &getItinerary() const;
+
+    private:
+        std::shared_ptr<PlanState> state_;
+    };
+}
+
+#endif //KRAKEN_PLAN_HANDLE_H
@@ -0,0 +1,37 @@
+#include "planner_parameters.h"
+
+#include <algorithm>
+
+#include "../configuration/configuration_handler.h"
+
+namespace kraken
+{
+    PlannerParameters::PlannerParameters(ConfigurationHandler &configuration_handler) :
+            necessary_margin(configuration_handler.get<float>(ConfigKey::NecessaryMargin)),
+            margin_before_collision(configuration_handler.get<float>(ConfigKey::MarginBeforeCollision)),
+            max_curvature_derivative(configuration_handler.get<float>(ConfigKey::MaxCurvatureDerivative)),
+            max_lateral_acceleration(configuration_handler.get<float>(ConfigKey::MaxLateralAcceleration)),
+            max_linear_acceleration(configuration_handler.get<float>(ConfigKey::MaxLinearAcceleration)),
+            default_max_speed(configuration_handler.get<float>(ConfigKey::DefaultMaxSpeed)),
+            minimal_speed(configuration_handler.get<float>(ConfigKey::MinimalSpeed)),
+            max_curvature(configuration_handler.get<float>(ConfigKey::MaxCurvature)),
+            stop_duration(configuration_handler.get<float>(ConfigKey::StopDuration)),
+            search_timeout(configuration_handler.get<float>(ConfigKey::SearchTimeout)),
+            thread_number(configuration_handler.get<int>(ConfigKey::ThreadNumber)),
+            enable_debug(configuration_handler.get<bool>(ConfigKey::EnableDebug)),
+            allow_backward_motion(configuration_handler.get<bool>(ConfigKey::AllowBackwardMotion)),
+            node_memory_pool_size(std::max(configuration_handler.get<int>(ConfigKey::NodeMemoryPoolSize), 0)),
+            obstacles_memory_pool_size(std::max(configuration_handler.get<int>(ConfigKey::ObstaclesMemoryPoolSize), 0)),
+            plan_cache_size(std::max(configuration_handler.get<int>(ConfigKey::PlanCacheSize), 0)),
+            precision_trace(configuration_handler.get<float>(ConfigKey::PrecisionTrace)),
+            nb_points(configuration_handler.get<int>(ConfigKey::NbPoints))
+    {
+
+    }
+
+    bool PlannerParameters::hasSameTentacles(const PlannerParameters &other) const
+    {
+        return max_curvature == other.max_curvature && max_curvature_derivative == other.max_curvature_derivative
+               && precision_trace == other.precision_trace && nb_points == other.nb_points;
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef KRAKEN_PLANNER_PARAMETERS_H
+#define KRAKEN_PLANNER_PARAMETERS_H
+
+namespace kraken
+{
+    class ConfigurationHandler;
+
+    /*
+     * The configuration values used by the planner, read once. A planning request works on a copy, so the
+     * configuration can change while it runs.
+     */
+    struct PlannerParameters
+    {
+        explicit PlannerParameters(ConfigurationHandler &configuration_handler);
+
+        bool hasSameTentacles(const PlannerParameters &other) const;
+
+        //Auto replanning
+        float necessary_margin;
+        float margin_before_collision;
+
+        //Research and mechanical parameters, see ConfigKey for the units
+        float max_curvature_derivative;
+        float max_lateral_acceleration;
+        float max_linear_acceleration;
+        float default_max_speed;
+        float minimal_speed;
+        float max_curvature;
+        float stop_duration;
+        float search_timeout;
+        int thread_number;
+        bool enable_debug;
+        bool allow_backward_motion;
+
+        //Memory management parameters, a negative value in the configuration is read as 0
+        int node_memory_pool_size;
+        int obstacles_memory_pool_size;
+        int plan_cache_size;
+
+        //Tentacle parameters
+        float precision_trace;
+        int nb_points;
+    };
+}
+
+#endif //KRAKEN_PLANNER_PARAMETERS_H
@@ -0,0 +1,159 @@
+#include "planner_service.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "../configuration/configuration_handler.h"
+#include "../instrumentation/trace_recorder.h"
+
+namespace kraken
+{
+    PlannerService::PlannerService(ConfigurationHandler &configuration_handler, std::ostream &statistics_stream) :
+            statistics_(statistics_stream), plan_cache_(0), logging_requests_(false)
+    {
+        reload(configuration_handler);
+        statistics_.attach(configuration_handler);
+        TraceRecorder::attach(configuration_handler);
+
+        // Once per update, even if it changes several modules
+        configuration_handler.registerUpdateCallback(
+                [this](ConfigurationHandler &ch, const std::vector<ConfigKey> &changed_keys) {
+                    bool planner_changed = std::any_of(changed_keys.begin(), changed_keys.end(),
+                                                       [&ch](ConfigKey key) {
+                                                           return ch.getModuleEnumFromKeyEnum(key) !=
+                                                                  ConfigModule::Navmesh;
+                                                       });
+                    if (planner_changed)
+                        reload(ch);
+                });
+    }
+
+    std::unique_ptr<PlanningContext> PlannerService::createContext()
+    {
+        return std::unique_ptr<PlanningContext>(new PlanningContext(*this));
+    }
+
+    DynamicObstacleSet PlannerService::createObstacleSet() const
+    {
+        auto capacity = static_cast<std::size_t>(getSnapshot()->parameters.obstacles_memory_pool_size);
+        return DynamicObstacleSet(100.f, 50, capacity);
+    }
+
+    void PlannerService::setNavmesh(std::shared_ptr<const Navmesh> navmesh)
+    {
+        std::lock_guard<std::mutex> lock(update_mutex_);
+        storeNavmesh(std::move(navmesh));
+    }
+
+    int PlannerService::addFixedObstacle(const std::vector<Vector2D> &polygon)
+    {
+        std::lock_guard<std::mutex> lock(update_mutex_);
+        auto previous = getSnapshot();
+        if (!previous->navmesh)
+            return -1;
+
+        auto begin = std::chrono::steady_clock::now();
+        auto navmesh = std::make_shared<Navmesh>(*previous->navmesh);
+        int obstacle = navmesh->addPolygon(polygon);
+        recordNavmeshLoad(begin);
+        storeNavmesh(std::move(navmesh));
+        return obstacle;
+    }
+
+    bool PlannerService::removeFixedObstacle(int obstacle)
+    {
+        std::lock_guard<std::mutex> lock(update_mutex_);
+        auto previous = getSnapshot();
+        if (!previous->navmesh || !previous->navmesh->hasPolygon(obstacle))
+            return false;
+
+        auto begin = std::chrono::steady_clock::now();
+        auto navmesh = std::make_shared<Navmesh>(*previous->navmesh);
+        navmesh->removePolygon(obstacle);
+        recordNavmeshLoad(begin);
+        storeNavmesh(std::move(navmesh));
+        return true;
+    }
+
+    void PlannerService::setRequestLog(std::ostream *strm)
+    {
+        std::lock_guard<std::mutex> lock(request_log_mutex_);
+        if (strm == nullptr)
+            request_log_.reset();
+        else
+            request_log_.reset(new RequestLogWriter(*strm));
+        logging_requests_.store(strm != nullptr);
+    }
+
+    bool PlannerService::isLoggingRequests() const
+    {
+        return logging_requests_.load(std::memory_order_relaxed);
+    }
+
+    void PlannerService::logRequest(const PlanningRequest &request)
+    {
+        std::lock_guard<std::mutex> lock(request_log_mutex_);
+        if (request_log_)
+            request_log_->write(request);
+    }
+
+    std::shared_ptr<const PlannerSnapshot> PlannerService::getSnapshot() const
+    {
+        return std::atomic_load(&snapshot_);
+    }
+
+    StatisticsRegistry &PlannerService::getStatistics()
+    {
+        return statistics_;
+    }
+
+    PlanCache &PlannerService::getPlanCache()
+    {
+        return plan_cache_;
+    }
+
+    void PlannerService::reload(ConfigurationHandler &configuration_handler)
+    {
+        PlannerParameters parameters(configuration_handler);
+        std::lock_guard<std::mutex> lock(update_mutex_);
+        auto previous = getSnapshot();
+
+        std::shared_ptr<const TentacleLibrary> tentacles;
+        if (previous && previous->parameters.hasSameTentacles(parameters))
+            tentacles = previous->tentacles;
+        else
+            tentacles = std::make_shared<const TentacleLibrary>(
+                    parameters.max_curvature, parameters.max_curvature_derivative, parameters.precision_trace,
+                    parameters.nb_points,
+                    parameters.max_curvature_derivative * parameters.precision_trace * parameters.nb_points);
+
+        std::shared_ptr<const Navmesh> navmesh;
+        if (previous)
+            navmesh = previous->navmesh;
+        std::vector<std::string> sections;
+        for (unsigned long i = 0; i < ConfigurationHandler::module_count; i++)
+            sections.push_back(configuration_handler.getSectionName(static_cast<ConfigModule>(i)));
+        std::atomic_store(&snapshot_, std::shared_ptr<const PlannerSnapshot>(
+                new PlannerSnapshot{parameters, std::move(tentacles), std::move(navmesh), std::move(sections)}));
+
+        // The cached itineraries may not be feasible with the new parameters
+        plan_cache_.clear();
+        plan_cache_.resize(static_cast<std::size_t>(parameters.plan_cache_size));
+    }
+
+    void PlannerService::recordNavmeshLoad(std::chrono::steady_clock::time_point begin)
+    {
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - begin);
+        statistics_.recordPhase(PlanningPhase::NavmeshLoad, static_cast<std::uint32_t>(duration.count()));
+    }
+
+    void PlannerService::storeNavmesh(std::shared_ptr<const Navmesh> navmesh)
+    {
+        auto previous = getSnapshot();
+        std::atomic_store(&snapshot_, std::shared_ptr<const PlannerSnapshot>(
+                new PlannerSnapshot{previous->parameters, previous->tentacles, std::move(navmesh),
+                                    previous->sections}));
+        plan_cache_.clear();
+    }
+}
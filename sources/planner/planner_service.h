@@ -0,0 +1,95 @@
+#ifndef KRAKEN_PLANNER_SERVICE_H
+#define KRAKEN_PLANNER_SERVICE_H
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+
+#include "planner_snapshot.h"
+#include "plan_cache.h"
+#include "planning_context.h"
+#include "../instrumentation/statistics_registry.h"
+#include "../replay/request_log.h"
+
+namespace kraken
+{
+    class ConfigurationHandler;
+
+    /*
+     * Owns what the planning contexts share : the configuration snapshot, the tentacle library, the navmesh and the
+     * statistics.
+     * Any number of contexts, e.g. one per robot, can plan concurrently from different threads ; each one only
+     * allocates its own node pool and scratch buffers.
+     * The service registers callbacks on the configuration handler, so it must outlive it. EnableDebug turns on the
+     * statistics dumps and the TraceRecorder.
+     */
+    class PlannerService
+    {
+    public:
+        explicit PlannerService(ConfigurationHandler &configuration_handler,
+                                std::ostream &statistics_stream = std::clog);
+
+        PlannerService(const PlannerService &) = delete;
+        PlannerService &operator=(const PlannerService &) = delete;
+
+        std::unique_ptr<PlanningContext> createContext();
+
+        /**
+         * @return an empty obstacle set, reserved for ObstaclesMemoryPoolSize obstacles
+         */
+        DynamicObstacleSet createObstacleSet() const;
+
+        /**
+         * Sets the navmesh of the fixed obstacles. The searches avoid its blocked triangles and follow the shortest
+         * path in it ; a request whose goal cannot be reached in the navmesh fails immediately.
+         * @param navmesh may be null
+         */
+        void setNavmesh(std::shared_ptr<const Navmesh> navmesh);
+
+        /**
+         * Adds a fixed obstacle to a copy of the navmesh, retriangulated around the polygon only, and publishes it.
+         * The running searches keep the previous navmesh.
+         * @param polygon convex, in any orientation
+         * @return the identifier of the obstacle, -1 if there is no navmesh
+         */
+        int addFixedObstacle(const std::vector<Vector2D> &polygon);
+
+        /**
+         * @param obstacle identifier returned by addFixedObstacle
+         * @return false if the identifier is unknown or already removed, the navmesh is then unchanged
+         */
+        bool removeFixedObstacle(int obstacle);
+
+        /**
+         * Logs every request planned by the contexts of the service, with its result, in the format of
+         * RequestLogWriter. The log is off by default.
+         * @param strm may be null to stop logging ; must stay valid until the log is stopped
+         */
+        void setRequestLog(std::ostream *strm);
+
+        bool isLoggingRequests() const;
+        void logRequest(const PlanningRequest &request);
+
+        std::shared_ptr<const PlannerSnapshot> getSnapshot() const;
+        StatisticsRegistry &getStatistics();
+        PlanCache &getPlanCache();
+
+    private:
+        void reload(ConfigurationHandler &configuration_handler);
+        void recordNavmeshLoad(std::chrono::steady_clock::time_point begin);
+        void storeNavmesh(std::shared_ptr<const Navmesh> navmesh);
+
+        std::shared_ptr<const PlannerSnapshot> snapshot_;
+        std::mutex update_mutex_;
+        StatisticsRegistry statistics_;
+        PlanCache plan_cache_;
+
+        std::mutex request_log_mutex_;
+        std::unique_ptr<RequestLogWriter> request_log_;
+        std::atomic<bool> logging_requests_;
+    };
+}
+
+#endif //KRAKEN_PLANNER_SERVICE_H
@@ -0,0 +1,31 @@
+#ifndef KRAKEN_PLANNER_SNAPSHOT_H
+#define KRAKEN_PLANNER_SNAPSHOT_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "planner_parameters.h"
+#include "../navmesh/navmesh.h"
+#include "../tentacles/tentacle_library.h"
+
+namespace kraken
+{
+    /*
+     * Read-only state shared by every planning context. A new snapshot is made when the configuration changes,
+     * the large tables being shared with the previous snapshot when they are unchanged.
+     */
+    struct PlannerSnapshot
+    {
+        PlannerParameters parameters;
+        std::shared_ptr<const TentacleLibrary> tentacles;
+
+        //The fixed obstacles, may be null
+        std::shared_ptr<const Navmesh> navmesh;
+
+        //The configuration section of each module at the last reload, recorded with the logged requests
+        std::vector<std::string> sections;
+    };
+}
+
+#endif //KRAKEN_PLANNER_SNAPSHOT_H
@@ -0,0 +1,6 @@
+#include "planning_context_impl.h"
+
+namespace kraken
+{
+    template class BasicPlanningContext<RuntimeRobotModel>;
+}
@@ -0,0 +1,110 @@
+#ifndef KRAKEN_PLANNING_CONTEXT_H
+#define KRAKEN_PLANNING_CONTEXT_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "closed_set.h"
+#include "node_pool.h"
+#include "planner_snapshot.h"
+#include "robot_model.h"
+#include "../navmesh/navmesh_query.h"
+#include "../obstacles/dynamic_obstacle_set.h"
+#include "../struct/kinematic.h"
+#include "../trajectory/speed_profile.h"
+
+namespace kraken
+{
+    class PlannerService;
+
+    namespace SearchStatuses {
+        enum class SearchStatuses {
+            Success = 0,
+            NoPath,
+            Timeout,
+            PoolExhausted,
+            Cancelled
+        };
+    }
+    using SearchStatus = SearchStatuses::SearchStatuses;
+
+    /*
+     * Per-request state of the planner : the node pool and the scratch buffers of the search.
+     * A context plans one request at a time ; use one context per thread.
+     * RobotModel provides the mechanical limits (see robot_model.h). PlanningContext reads them from the
+     * configuration ; to plan with a StaticRobotModel, include planning_context_impl.h.
+     */
+    template<class RobotModel>
+    class BasicPlanningContext
+    {
+    public:
+        explicit BasicPlanningContext(PlannerService &service);
+
+        BasicPlanningContext(const BasicPlanningContext &) = delete;
+        BasicPlanningContext &operator=(const BasicPlanningContext &) = delete;
+
+        /**
+         * Searches a kinematically feasible itinerary with clothoid tentacles (A*, travel time cost).
+         * The goal is reached when the robot is closer to its position than the length of a tentacle.
+         * With a navmesh, the heuristic follows the shortest path in the navmesh (funnel algorithm) : it is tighter
+         * than the straight line, though not admissible far from that path.
+         * When the node pool is full, the worst half of the open list is pruned, a few times per search. Past that, the
+         * status is PoolExhausted and the itinerary leads to the expanded node closest to the goal ; it is not cached.
+         * @param start
+         * @param goal
+         * @param obstacles
+         * @param itinerary output, cleared first
+         * @param interruption if not null, checked between two node expansions : the search stops with the status
+         * Cancelled as soon as it is set
+         * @return
+         */
+        SearchStatus plan(const Kinematic &start, const Kinematic &goal, const DynamicObstacleSet &obstacles,
+                          std::vector<ItineraryPoint> &itinerary,
+                          const std::atomic<bool> *interruption = nullptr);
+
+        const NodePool &getNodePool() const;
+
+    private:
+        SearchStatus search(const RobotModel &robot, const Kinematic &start, const Kinematic &goal,
+                            const DynamicObstacleSet &obstacles, const std::atomic<bool> *interruption,
+                            const SearchNode *&goal_node);
+
+        SearchNode *generate(const RobotModel &robot, const SearchNode &parent, bool going_forward, int to_index,
+                             const Vector2D &goal, const DynamicObstacleSet &obstacles);
+
+        /**
+         * Releases the open nodes with the largest estimated total cost. They are leaves, no node points to them.
+         * @return false if there is nothing to prune
+         */
+        bool pruneOpenList();
+
+        void buildItinerary(const RobotModel &robot, const Kinematic &start, const SearchNode *goal_node,
+                            std::vector<ItineraryPoint> &itinerary);
+
+        bool buildGuide(const Kinematic &start, const Kinematic &goal);
+        float getHeuristic(const RobotModel &robot, const Vector2D &position, const Vector2D &goal) const;
+        std::uint64_t getClosedKey(const RobotModel &robot, const SearchNode &node) const;
+
+        PlannerService &service_;
+        std::shared_ptr<const PlannerSnapshot> snapshot_;
+        float goal_tolerance_;
+
+        NodePool pool_;
+        std::vector<SearchNode *> open_list_;
+        ClosedSet closed_;
+        std::vector<const SearchNode *> path_nodes_;
+        std::vector<PathSample> samples_;
+
+        //The shortest path in the navmesh, and the remaining length from each of its points
+        NavmeshQuery navmesh_query_;
+        std::vector<Vector2D> guide_;
+        std::vector<float> guide_remaining_;
+    };
+
+    extern template class BasicPlanningContext<RuntimeRobotModel>;
+    using PlanningContext = BasicPlanningContext<RuntimeRobotModel>;
+}
+
+#endif //KRAKEN_PLANNING_CONTEXT_H
@@ -0,0 +1,410 @@
+#ifndef KRAKEN_PLANNING_CONTEXT_IMPL_H
+#define KRAKEN_PLANNING_CONTEXT_IMPL_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "planning_context.h"
+#include "planner_service.h"
+#include "../instrumentation/search_statistics.h"
+#include "../instrumentation/trace_recorder.h"
+#include "../utils/math_utils.h"
+
+namespace kraken
+{
+    namespace planning_context
+    {
+        constexpr int orientation_bins = 64;
+        constexpr unsigned int expansions_between_timeout_checks = 32;
+        //Beyond, the pool is too small for the request and the search returns its best partial path
+        constexpr int max_pool_prunings = 8;
+
+        inline bool isWorse(const SearchNode *lhs, const SearchNode *rhs)
+        {
+            return lhs->estimated_total_cost > rhs->estimated_total_cost;
+        }
+    }
+
+    template<class RobotModel>
+    BasicPlanningContext<RobotModel>::BasicPlanningContext(PlannerService &service) :
+            service_(service), snapshot_(service.getSnapshot()), goal_tolerance_(0),
+            pool_(static_cast<std::size_t>(snapshot_->parameters.node_memory_pool_size)),
+            closed_(static_cast<std::size_t>(snapshot_->parameters.node_memory_pool_size))
+    {
+
+    }
+
+    template<class RobotModel>
+    SearchStatus BasicPlanningContext<RobotModel>::plan(const Kinematic &start, const Kinematic &goal,
+                                                        const DynamicObstacleSet &obstacles,
+                                                        std::vector<ItineraryPoint> &itinerary,
+                                                        const std::atomic<bool> *interruption)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        auto &statistics = search_statistics::local();
+        statistics.reset();
+        itinerary.clear();
+
+        snapshot_ = service_.getSnapshot();
+        auto pool_size = static_cast<std::size_t>(snapshot_->parameters.node_memory_pool_size);
+        if (pool_.getCapacity() != pool_size)
+        {
+            pool_.resize(pool_size);
+            closed_.resize(pool_size);
+        }
+
+        const auto &parameters = snapshot_->parameters;
+        const RobotModel robot(*snapshot_);
+        auto &plan_cache = service_.getPlanCache();
+        SearchStatus status = SearchStatus::Success;
+        if (plan_cache.find(start, goal, obstacles, parameters.necessary_margin + robot.getFootprintRadius(),
+                            parameters.minimal_speed, itinerary))
+            statistics.increment(SearchCounter::CacheHits);
+        else
+        {
+            statistics.increment(SearchCounter::CacheMisses);
+            const SearchNode *goal_node = nullptr;
+            {
+                ScopedPhaseTimer timer(PlanningPhase::Search);
+                ScopedTrace trace(PlanningPhase::Search);
+                status = search(robot, start, goal, obstacles, interruption, goal_node);
+            }
+            if (status == SearchStatus::Success)
+            {
+                buildItinerary(robot, start, goal_node, itinerary);
+                plan_cache.insert(start, goal, itinerary);
+            }
+            else if (status == SearchStatus::PoolExhausted && goal_node != nullptr && goal_node->parent != nullptr)
+                buildItinerary(robot, start, goal_node, itinerary);
+        }
+
+        statistics.updatePoolUsage(static_cast<std::uint32_t>(pool_.getHighWaterMark()));
+        statistics.updateObstacleUsage(static_cast<std::uint32_t>(obstacles.getObstacles().size()));
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - begin);
+        service_.getStatistics().publish(statistics, static_cast<std::uint32_t>(duration.count()));
+
+        if (service_.isLoggingRequests())
+        {
+            PlanningRequest request;
+            request.start = start;
+            request.goal = goal;
+            request.obstacles = obstacles.getObstacles();
+            std::copy(snapshot_->sections.begin(), snapshot_->sections.end(), request.sections);
+            // ItineraryPoint is not assignable
+            request.result = std::vector<ItineraryPoint>(itinerary.begin(), itinerary.end());
+            service_.logRequest(request);
+        }
+        return status;
+    }
+
+    template<class RobotModel>
+    const NodePool &BasicPlanningContext<RobotModel>::getNodePool() const
+    {
+        return pool_;
+    }
+
+    template<class RobotModel>
+    SearchStatus BasicPlanningContext<RobotModel>::search(const RobotModel &robot, const Kinematic &start,
+                                                          const Kinematic &goal, const DynamicObstacleSet &obstacles,
+                                                          const std::atomic<bool> *interruption,
+                                                          const SearchNode *&goal_node)
+    {
+        const auto &parameters = snapshot_->parameters;
+        const auto &tentacles = robot.getTentacles();
+        const auto &goal_position = goal.getPosition();
+        auto &statistics = search_statistics::local();
+        auto deadline = std::chrono::steady_clock::now()
+                        + std::chrono::microseconds(static_cast<std::int64_t>(parameters.search_timeout * 1000));
+
+        goal_tolerance_ = robot.getTentacleLength();
+        pool_.reset();
+        open_list_.clear();
+        closed_.clear();
+        if (!buildGuide(start, goal))
+            return SearchStatus::NoPath;
+
+        auto root = pool_.allocate();
+        if (root == nullptr)
+            return SearchStatus::PoolExhausted;
+        root->position = start.getPosition();
+        root->orientation = start.getGeometricOrientation();
+        root->curvature_index = tentacles.getNearestCurvatureIndex(start.getGeometricCurvature());
+        root->going_forward = start.getGoingForward();
+        root->triangle = snapshot_->navmesh ? snapshot_->navmesh->locate(root->position) : -1;
+        root->start_orientation = root->orientation;
+        root->start_curvature_index = root->curvature_index;
+        root->after_stop = false;
+        root->cost = 0;
+        root->estimated_total_cost = getHeuristic(robot, root->position, goal_position);
+        root->parent = nullptr;
+
+        if (root->position.squaredDistance(goal_position) < goal_tolerance_ * goal_tolerance_)
+        {
+            goal_node = root;
+            return SearchStatus::Success;
+        }
+
+        closed_.insert(getClosedKey(robot, *root), 0);
+        open_list_.push_back(root);
+        unsigned int expanded = 0;
+        int prunings = 0;
+        // Expanded nodes are never released : the best one is the end of the partial path if the pool is exhausted
+        const SearchNode *best_node = root;
+
+        while (!open_list_.empty())
+        {
+            std::pop_heap(open_list_.begin(), open_list_.end(), planning_context::isWorse);
+            SearchNode *node = open_list_.back();
+            open_list_.pop_back();
+
+            // A cheaper path to the same state was found after this node was pushed
+            float closed_cost;
+            if (closed_.find(getClosedKey(robot, *node), closed_cost) && closed_cost < node->cost)
+            {
+                pool_.release(node);
+                continue;
+            }
+
+            if (interruption != nullptr && interruption->load(std::memory_order_relaxed))
+                return SearchStatus::Cancelled;
+            if (++expanded % planning_context::expansions_between_timeout_checks == 0
+                && std::chrono::steady_clock::now() > deadline)
+                return SearchStatus::Timeout;
+            statistics.increment(SearchCounter::NodesExpanded);
+            if (node->estimated_total_cost - node->cost < best_node->estimated_total_cost - best_node->cost)
+                best_node = node;
+
+            for (int direction = 0; direction < (robot.allowBackwardMotion() ? 2 : 1); direction++)
+            {
+                bool going_forward = direction == 0;
+                int from_index = going_forward == node->going_forward ? node->curvature_index
+                                                                      : -node->curvature_index;
+                for (int to_index = from_index - robot.getMaxIndexJump();
+                     to_index <= from_index + robot.getMaxIndexJump(); to_index++)
+                {
+                    // from_index is always reachable, and the loop bounds limit the jump
+                    if (std::abs(to_index) > robot.getMaxCurvatureIndex())
+                        continue;
+
+                    if (pool_.getUsed() == pool_.getCapacity()
+                        && (prunings++ == planning_context::max_pool_prunings || !pruneOpenList()))
+                    {
+                        goal_node = best_node;
+                        return SearchStatus::PoolExhausted;
+                    }
+
+                    auto child = generate(robot, *node, going_forward, to_index, goal_position, obstacles);
+                    if (child == nullptr)
+                        continue;
+
+                    if (child->position.squaredDistance(goal_position) < goal_tolerance_ * goal_tolerance_)
+                    {
+                        goal_node = child;
+                        return SearchStatus::Success;
+                    }
+                    open_list_.push_back(child);
+                    std::push_heap(open_list_.begin(), open_list_.end(), planning_context::isWorse);
+                }
+            }
+        }
+        return SearchStatus::NoPath;
+    }
+
+    template<class RobotModel>
+    SearchNode *BasicPlanningContext<RobotModel>::generate(const RobotModel &robot, const SearchNode &parent,
+                                                           bool going_forward, int to_index, const Vector2D &goal,
+                                                           const DynamicObstacleSet &obstacles)
+    {
+        const auto &parameters = snapshot_->parameters;
+        const auto &tentacles = robot.getTentacles();
+
+        auto child = pool_.allocate();
+        if (child == nullptr)
+            return nullptr;
+        search_statistics::local().increment(SearchCounter::NodesGenerated);
+
+        bool after_stop = going_forward != parent.going_forward;
+        int from_index = after_stop ? -parent.curvature_index : parent.curvature_index;
+        float start_orientation = after_stop ? parent.orientation + static_cast<float>(M_PI) : parent.orientation;
+        float cos = std::cos(start_orientation);
+        float sin = std::sin(start_orientation);
+
+        // The speed on the tentacle is limited by the lateral acceleration at its largest curvature
+        float curvature = std::max(std::abs(tentacles.getCurvature(from_index)),
+                                   std::abs(tentacles.getCurvature(to_index)));
+        float speed = robot.getMaxSpeed();
+        if (curvature * speed * speed > robot.getMaxLateralAcceleration())
+            speed = std::sqrt(robot.getMaxLateralAcceleration() / curvature);
+        float start_time = parent.cost + (after_stop ? parameters.stop_duration : 0);
+        float duration = robot.getTentacleLength() / speed;
+        float margin = parameters.necessary_margin + robot.getFootprintRadius();
+        const Navmesh *navmesh = snapshot_->navmesh.get();
+        int triangle = parent.triangle;
+
+        TentaclePoint point = {};
+        for (int i = 0; i < robot.getPointCount(); i++)
+        {
+            point = tentacles.getPoint(from_index, to_index, i);
+            point.position.rotate(cos, sin);
+            point.position += parent.position;
+            bool colliding = obstacles.isColliding(point.position,
+                                                   start_time + duration * (i + 1) / robot.getPointCount(), margin);
+            if (navmesh != nullptr && !colliding)
+            {
+                // The walk starts from the triangle of the previous point. Entering a blocked triangle collides,
+                // leaving one does not : the robot may start against a fixed obstacle.
+                int previous = triangle;
+                triangle = navmesh->locate(point.position, previous);
+                colliding = triangle == -1 || (navmesh->getTriangle(triangle).blocked
+                                               && (previous == -1 || !navmesh->getTriangle(previous).blocked));
+            }
+            if (colliding)
+            {
+                pool_.release(child);
+                return nullptr;
+            }
+        }
+
+        child->position = point.position;
+        child->orientation = start_orientation + point.orientation;
+        child->curvature_index = to_index;
+        child->going_forward = going_forward;
+        child->triangle = triangle;
+        child->start_orientation = start_orientation;
+        child->start_curvature_index = from_index;
+        child->after_stop = after_stop;
+        child->cost = start_time + duration;
+        child->estimated_total_cost = child->cost + getHeuristic(robot, child->position, goal);
+        child->parent = &parent;
+
+        auto key = getClosedKey(robot, *child);
+        float closed_cost;
+        if (closed_.find(key, closed_cost) && closed_cost <= child->cost)
+        {
+            pool_.release(child);
+            return nullptr;
+        }
+        closed_.insert(key, child->cost);
+        return child;
+    }
+
+    template<class RobotModel>
+    bool BasicPlanningContext<RobotModel>::pruneOpenList()
+    {
+        if (open_list_.empty())
+            return false;
+
+        // The pruned states stay in the closed set : the search does not come back to the abandoned branches
+        auto kept = open_list_.size() / 2;
+        std::nth_element(open_list_.begin(), open_list_.begin() + kept, open_list_.end(),
+                         [](const SearchNode *lhs, const SearchNode *rhs) {
+                             return lhs->estimated_total_cost < rhs->estimated_total_cost;
+                         });
+        for (auto it = open_list_.begin() + kept; it != open_list_.end(); ++it)
+            pool_.release(*it);
+        search_statistics::local().increment(SearchCounter::NodesPruned,
+                                             static_cast<std::uint32_t>(open_list_.size() - kept));
+        open_list_.resize(kept);
+        std::make_heap(open_list_.begin(), open_list_.end(), planning_context::isWorse);
+        return true;
+    }
+
+    template<class RobotModel>
+    void BasicPlanningContext<RobotModel>::buildItinerary(const RobotModel &robot, const Kinematic &start,
+                                                          const SearchNode *goal_node,
+                                                          std::vector<ItineraryPoint> &itinerary)
+    {
+        const auto &tentacles = robot.getTentacles();
+
+        path_nodes_.clear();
+        for (auto node = goal_node; node != nullptr; node = node->parent)
+            path_nodes_.push_back(node);
+        std::reverse(path_nodes_.begin(), path_nodes_.end());
+
+        samples_.clear();
+        samples_.push_back({start.getPosition(), start.getRealOrientation(), start.getRealCurvature(),
+                            start.getGoingForward(), false});
+        for (std::size_t n = 1; n < path_nodes_.size(); n++)
+        {
+            const auto &node = *path_nodes_[n];
+            if (node.after_stop)
+                samples_.back().stop = true;
+
+            float cos = std::cos(node.start_orientation);
+            float sin = std::sin(node.start_orientation);
+            for (int i = 0; i < robot.getPointCount(); i++)
+            {
+                auto point = tentacles.getPoint(node.start_curvature_index, node.curvature_index, i);
+                point.position.rotate(cos, sin);
+                point.position += node.parent->position;
+                float orientation = node.start_orientation + point.orientation;
+                if (node.going_forward)
+                    samples_.push_back({point.position, orientation, point.curvature, true, false});
+                else
+                    samples_.push_back({point.position, orientation + static_cast<float>(M_PI), -point.curvature,
+                                        false, false});
+            }
+        }
+
+        speed_profile::build(samples_, robot.getMaxSpeed(), robot.getMaxLateralAcceleration(),
+                             robot.getMaxLinearAcceleration(), itinerary);
+    }
+
+    template<class RobotModel>
+    bool BasicPlanningContext<RobotModel>::buildGuide(const Kinematic &start, const Kinematic &goal)
+    {
+        guide_.clear();
+        guide_remaining_.clear();
+        if (!snapshot_->navmesh)
+            return true;
+
+        ScopedPhaseTimer timer(PlanningPhase::HeuristicBuild);
+        ScopedTrace trace(PlanningPhase::HeuristicBuild);
+        if (!navmesh_query_.findPath(*snapshot_->navmesh, start.getPosition(), goal.getPosition(), guide_))
+            return false;
+        guide_remaining_.resize(guide_.size());
+        guide_remaining_.back() = 0;
+        for (auto i = guide_.size() - 1; i > 0; i--)
+            guide_remaining_[i - 1] = guide_remaining_[i] + guide_[i - 1].distance(guide_[i]);
+        return true;
+    }
+
+    template<class RobotModel>
+    float BasicPlanningContext<RobotModel>::getHeuristic(const RobotModel &robot, const Vector2D &position,
+                                                         const Vector2D &goal) const
+    {
+        float distance = position.distance(goal);
+        // Distance to the nearest point of the guide, then along the guide : never shorter than the straight line
+        for (std::size_t i = 0; i + 1 < guide_.size(); i++)
+        {
+            Vector2D segment = guide_[i + 1] - guide_[i];
+            float length = guide_remaining_[i] - guide_remaining_[i + 1];
+            float ratio = length > 0 ? std::max(0.f, std::min(1.f, (position - guide_[i]).dot(segment)
+                                                                   / (length * length))) : 0;
+            segment *= ratio;
+            float through = position.distance(guide_[i] + segment) + (1 - ratio) * length + guide_remaining_[i + 1];
+            if (i == 0 || through < distance)
+                distance = through;
+        }
+        return std::max(0.f, distance - goal_tolerance_) / robot.getMaxSpeed();
+    }
+
+    template<class RobotModel>
+    std::uint64_t BasicPlanningContext<RobotModel>::getClosedKey(const RobotModel &robot,
+                                                                 const SearchNode &node) const
+    {
+        float cell_size = goal_tolerance_ / 2;
+        auto x = static_cast<std::uint16_t>(static_cast<int>(std::floor(node.position.getX() / cell_size)));
+        auto y = static_cast<std::uint16_t>(static_cast<int>(std::floor(node.position.getY() / cell_size)));
+        auto orientation = static_cast<std::uint64_t>(math_utils::computeNewOrientation(node.orientation)
+                                                      * planning_context::orientation_bins / (2 * M_PI))
+                           % planning_context::orientation_bins;
+        auto curvature = static_cast<std::uint64_t>(node.curvature_index + robot.getMaxCurvatureIndex());
+        return (static_cast<std::uint64_t>(x) << 48) | (static_cast<std::uint64_t>(y) << 32) | (orientation << 16)
+               | (curvature << 1) | (node.going_forward ? 1 : 0);
+    }
+}
+
+#endif //KRAKEN_PLANNING_CONTEXT_IMPL_H
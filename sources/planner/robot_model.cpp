@@ -0,0 +1,59 @@
+#include "robot_model.h"
+
+namespace kraken
+{
+    RuntimeRobotModel::RuntimeRobotModel(const PlannerSnapshot &snapshot) : snapshot_(snapshot)
+    {
+
+    }
+
+    bool RuntimeRobotModel::allowBackwardMotion() const
+    {
+        return snapshot_.parameters.allow_backward_motion;
+    }
+
+    float RuntimeRobotModel::getMaxSpeed() const
+    {
+        return snapshot_.parameters.default_max_speed;
+    }
+
+    float RuntimeRobotModel::getMaxLateralAcceleration() const
+    {
+        return snapshot_.parameters.max_lateral_acceleration;
+    }
+
+    float RuntimeRobotModel::getMaxLinearAcceleration() const
+    {
+        return snapshot_.parameters.max_linear_acceleration;
+    }
+
+    float RuntimeRobotModel::getFootprintRadius() const
+    {
+        return 0;
+    }
+
+    int RuntimeRobotModel::getMaxCurvatureIndex() const
+    {
+        return snapshot_.tentacles->getMaxCurvatureIndex();
+    }
+
+    int RuntimeRobotModel::getMaxIndexJump() const
+    {
+        return snapshot_.tentacles->getMaxIndexJump();
+    }
+
+    int RuntimeRobotModel::getPointCount() const
+    {
+        return snapshot_.tentacles->getPointCount();
+    }
+
+    float RuntimeRobotModel::getTentacleLength() const
+    {
+        return snapshot_.tentacles->getLength();
+    }
+
+    const TentacleLibrary &RuntimeRobotModel::getTentacles() const
+    {
+        return *snapshot_.tentacles;
+    }
+}
@@ -0,0 +1,127 @@
+#ifndef KRAKEN_ROBOT_MODEL_H
+#define KRAKEN_ROBOT_MODEL_H
+
+#include "planner_snapshot.h"
+
+namespace kraken
+{
+    /*
+     * The mechanical limits of the robot, as read by the planner core (see BasicPlanningContext).
+     * This model reads them from the configuration snapshot of the request. The configured margins are measured
+     * from the robot center, so the footprint radius is 0.
+     */
+    class RuntimeRobotModel
+    {
+    public:
+        explicit RuntimeRobotModel(const PlannerSnapshot &snapshot);
+
+        bool allowBackwardMotion() const;
+        float getMaxSpeed() const;
+        float getMaxLateralAcceleration() const;
+        float getMaxLinearAcceleration() const;
+        float getFootprintRadius() const;
+
+        int getMaxCurvatureIndex() const;
+        int getMaxIndexJump() const;
+        int getPointCount() const;
+        float getTentacleLength() const;
+        const TentacleLibrary &getTentacles() const;
+
+    private:
+        const PlannerSnapshot &snapshot_;
+    };
+
+    /*
+     * The mechanical limits of a robot known at build time. Robot describes it with constexpr members :
+     *
+     *     struct Robot
+     *     {
+     *         static constexpr float max_curvature = 5;                //m^-1
+     *         static constexpr float max_curvature_derivative = 5;     //m^-2
+     *         static constexpr float max_lateral_acceleration = 3;     //m/s^2
+     *         static constexpr float max_linear_acceleration = 2;      //m/s^2
+     *         static constexpr float max_speed = 1;                    //m/s
+     *         static constexpr float footprint_radius = 0;             //mm, added to the margins
+     *         static constexpr bool allow_backward_motion = false;
+     *         static constexpr float precision_trace = 0.02f;          //m
+     *         static constexpr int nb_points = 5;
+     *     };
+     *
+     * The limits fold into the expansion loop, and the branches they disable are removed. The matching
+     * configuration keys are ignored ; the tentacles are built once per Robot and shared by every context.
+     */
+    template<class Robot>
+    class StaticRobotModel
+    {
+    public:
+        explicit StaticRobotModel(const PlannerSnapshot &)
+        {
+
+        }
+
+        static constexpr bool allowBackwardMotion()
+        {
+            return Robot::allow_backward_motion;
+        }
+
+        static constexpr float getMaxSpeed()
+        {
+            return Robot::max_speed;
+        }
+
+        static constexpr float getMaxLateralAcceleration()
+        {
+            return Robot::max_lateral_acceleration;
+        }
+
+        static constexpr float getMaxLinearAcceleration()
+        {
+            return Robot::max_linear_acceleration;
+        }
+
+        static constexpr float getFootprintRadius()
+        {
+            return Robot::footprint_radius;
+        }
+
+        //The curvature changes of one step along a tentacle, as with the configuration
+        static constexpr float getCurvatureStep()
+        {
+            return Robot::max_curvature_derivative * Robot::precision_trace * Robot::nb_points;
+        }
+
+        static constexpr int getMaxCurvatureIndex()
+        {
+            return static_cast<int>(Robot::max_curvature / getCurvatureStep() + 0.5f) > 1
+                   ? static_cast<int>(Robot::max_curvature / getCurvatureStep() + 0.5f) : 1;
+        }
+
+        static constexpr int getMaxIndexJump()
+        {
+            return 1;
+        }
+
+        static constexpr int getPointCount()
+        {
+            return Robot::nb_points;
+        }
+
+        static constexpr float getTentacleLength()
+        {
+            return Robot::precision_trace * Robot::nb_points * 1000;
+        }
+
+        static const TentacleLibrary &getTentacles()
+        {
+            static const TentacleLibrary tentacles(Robot::max_curvature, Robot::max_curvature_derivative,
+                                                   Robot::precision_trace, Robot::nb_points, getCurvatureStep());
+            return tentacles;
+        }
+
+        static_assert(Robot::nb_points > 0, "a tentacle has at least one point");
+        static_assert(Robot::max_curvature > 0 && Robot::max_curvature_derivative > 0 && Robot::max_speed > 0,
+                      "the mechanical limits must be positive");
+    };
+}
+
+#endif //KRAKEN_ROBOT_MODEL_H
@@ -0,0 +1,34 @@
+#ifndef KRAKEN_SEARCH_NODE_H
+#define KRAKEN_SEARCH_NODE_H
+
+#include "../struct/vector_2d.h"
+
+namespace kraken
+{
+    /*
+     * A node of the kinematic search : the state reached at the end of a tentacle.
+     * The orientations and the curvature indices are geometric (see TentaclePoint).
+     */
+    struct SearchNode
+    {
+        Vector2D position;
+        float orientation;
+        int curvature_index;
+        bool going_forward;
+
+        //The navmesh triangle of the position, -1 without navmesh
+        int triangle;
+
+        //The tentacle leading to this node, from the parent position
+        float start_orientation;
+        int start_curvature_index;
+        bool after_stop;
+
+        //Estimated travel time from the start, in ms
+        float cost;
+        float estimated_total_cost;
+        const SearchNode *parent;
+    };
+}
+
+#endif //KRAKEN_SEARCH_NODE_H
@@ -0,0 +1,162 @@
+#include "binary_codec.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace kraken
+{
+    namespace
+    {
+        constexpr std::uint8_t flag_going_forward = 1;
+        constexpr std::uint8_t flag_stop = 2;
+    }
+
+    BinaryWriter::BinaryWriter(std::vector<std::uint8_t> &buffer) : buffer_(buffer)
+    {
+
+    }
+
+    void BinaryWriter::writeUint8(std::uint8_t value)
+    {
+        buffer_.push_back(value);
+    }
+
+    void BinaryWriter::writeUint16(std::uint16_t value)
+    {
+        writeUint8(static_cast<std::uint8_t>(value));
+        writeUint8(static_cast<std::uint8_t>(value >> 8));
+    }
+
+    void BinaryWriter::writeUint32(std::uint32_t value)
+    {
+        writeUint16(static_cast<std::uint16_t>(value));
+        writeUint16(static_cast<std::uint16_t>(value >> 16));
+    }
+
+    void BinaryWriter::writeFloat(float value)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeUint32(bits);
+    }
+
+    void BinaryWriter::writeBytes(const void *data, std::size_t size)
+    {
+        auto bytes = static_cast<const std::uint8_t *>(data);
+        buffer_.insert(buffer_.end(), bytes, bytes + size);
+    }
+
+    void BinaryWriter::writeKinematic(const Kinematic &kinematic)
+    {
+        writeFloat(kinematic.getPosition().getX());
+        writeFloat(kinematic.getPosition().getY());
+        writeFloat(kinematic.getGeometricOrientation());
+        writeFloat(kinematic.getGeometricCurvature());
+        writeUint8((kinematic.getGoingForward() ? flag_going_forward : 0) | (kinematic.getStop() ? flag_stop : 0));
+    }
+
+    void BinaryWriter::writeItineraryPoint(const ItineraryPoint &point)
+    {
+        writeFloat(point.getX());
+        writeFloat(point.getY());
+        writeFloat(point.getOrientation());
+        writeFloat(point.getCurvature());
+        writeFloat(point.getMaxSpeed());
+        writeFloat(point.getPossibleSpeed());
+        writeUint8((point.getGoingForward() ? flag_going_forward : 0) | (point.getStop() ? flag_stop : 0));
+    }
+
+    BinaryReader::BinaryReader(const std::uint8_t *data, std::size_t size, std::string truncated_message) :
+            strm_(nullptr), data_(data), size_(size), position_(0), truncated_message_(std::move(truncated_message))
+    {
+
+    }
+
+    BinaryReader::BinaryReader(std::istream &strm, std::string truncated_message) :
+            strm_(&strm), data_(nullptr), size_(0), position_(0), truncated_message_(std::move(truncated_message))
+    {
+
+    }
+
+    std::uint8_t BinaryReader::readUint8()
+    {
+        if (strm_ == nullptr)
+        {
+            if (position_ == size_)
+                throw std::invalid_argument(truncated_message_);
+            return data_[position_++];
+        }
+
+        auto value = strm_->get();
+        if (value == std::char_traits<char>::eof())
+            throw std::invalid_argument(truncated_message_);
+        return static_cast<std::uint8_t>(value);
+    }
+
+    std::uint16_t BinaryReader::readUint16()
+    {
+        std::uint16_t low = readUint8();
+        return static_cast<std::uint16_t>(low | (readUint8() << 8));
+    }
+
+    std::uint32_t BinaryReader::readUint32()
+    {
+        std::uint32_t low = readUint16();
+        return low | (static_cast<std::uint32_t>(readUint16()) << 16);
+    }
+
+    float BinaryReader::readFloat()
+    {
+        auto bits = readUint32();
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    void BinaryReader::readBytes(void *data, std::size_t size)
+    {
+        if (strm_ == nullptr)
+        {
+            if (size > size_ - position_)
+                throw std::invalid_argument(truncated_message_);
+            std::memcpy(data, data_ + position_, size);
+            position_ += size;
+            return;
+        }
+
+        strm_->read(static_cast<char *>(data), size);
+        if (!*strm_)
+            throw std::invalid_argument(truncated_message_);
+    }
+
+    Kinematic BinaryReader::readKinematic()
+    {
+        float x = readFloat();
+        float y = readFloat();
+        float orientation = readFloat();
+        float curvature = readFloat();
+        auto flags = readUint8();
+        return Kinematic(x, y, orientation, (flags & flag_going_forward) != 0, curvature, (flags & flag_stop) != 0);
+    }
+
+    ItineraryPoint BinaryReader::readItineraryPoint()
+    {
+        float x = readFloat();
+        float y = readFloat();
+        float orientation = readFloat();
+        float curvature = readFloat();
+        float max_speed = readFloat();
+        float possible_speed = readFloat();
+        auto flags = readUint8();
+        return ItineraryPoint(Vector2D(x, y), orientation, curvature, (flags & flag_going_forward) != 0, max_speed,
+                              possible_speed, (flags & flag_stop) != 0);
+    }
+
+    bool BinaryReader::isAtEnd() const
+    {
+        if (strm_ == nullptr)
+            return position_ == size_;
+        return strm_->peek() == std::char_traits<char>::eof();
+    }
+}
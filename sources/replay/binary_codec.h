@@ -0,0 +1,74 @@
+#ifndef KRAKEN_BINARY_CODEC_H
+#define KRAKEN_BINARY_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "../struct/itinerary_point.h"
+#include "../struct/kinematic.h"
+
+namespace kraken
+{
+    /*
+     * Binary encoding of the request logs and of the daemon protocol. Every value is written in little-endian order
+     * and floats are stored bit for bit, so that the values are read back identical on another machine.
+     *   kinematic :       x, y, orientation, curvature (f32), flags (u8)
+     *   itinerary point : x, y, orientation, curvature, max speed, possible speed (f32), flags (u8)
+     */
+    class BinaryWriter
+    {
+    public:
+        /**
+         * @param buffer the values are appended to it
+         */
+        explicit BinaryWriter(std::vector<std::uint8_t> &buffer);
+
+        void writeUint8(std::uint8_t value);
+        void writeUint16(std::uint16_t value);
+        void writeUint32(std::uint32_t value);
+        void writeFloat(float value);
+        void writeBytes(const void *data, std::size_t size);
+        void writeKinematic(const Kinematic &kinematic);
+        void writeItineraryPoint(const ItineraryPoint &point);
+
+    private:
+        std::vector<std::uint8_t> &buffer_;
+    };
+
+    /*
+     * Reads the values of a BinaryWriter from a buffer or from a stream. Reading beyond the end throws
+     * std::invalid_argument with the message given at the construction.
+     */
+    class BinaryReader
+    {
+    public:
+        BinaryReader(const std::uint8_t *data, std::size_t size, std::string truncated_message);
+        BinaryReader(std::istream &strm, std::string truncated_message);
+
+        std::uint8_t readUint8();
+        std::uint16_t readUint16();
+        std::uint32_t readUint32();
+        float readFloat();
+        void readBytes(void *data, std::size_t size);
+        Kinematic readKinematic();
+        ItineraryPoint readItineraryPoint();
+
+        /**
+         * @return true if there is nothing left to read
+         */
+        bool isAtEnd() const;
+
+    private:
+        //Null when reading from the buffer
+        std::istream *strm_;
+        const std::uint8_t *data_;
+        std::size_t size_;
+        std::size_t position_;
+        const std::string truncated_message_;
+    };
+}
+
+#endif //KRAKEN_BINARY_CODEC_H
@@ -0,0 +1,112 @@
+#include "request_log.h"
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace kraken
+{
+    namespace
+    {
+        const char log_magic[4] = {'K', 'R', 'K', 'L'};
+        constexpr std::uint8_t log_version = 2;
+    }
+
+    RequestLogWriter::RequestLogWriter(std::ostream &strm) : strm_(strm)
+    {
+        strm_.write(log_magic, sizeof(log_magic));
+        strm_.put(static_cast<char>(log_version));
+    }
+
+    void RequestLogWriter::write(const PlanningRequest &request)
+    {
+        buffer_.clear();
+        BinaryWriter writer(buffer_);
+        writer.writeUint32(request.seed);
+        writer.writeKinematic(request.start);
+        writer.writeKinematic(request.goal);
+
+        writer.writeUint8(static_cast<std::uint8_t>(ConfigurationHandler::module_count));
+        for (const auto &section : request.sections)
+        {
+            if (section.size() > UINT8_MAX)
+                throw std::invalid_argument("Section name too long for the request log : " + section);
+            writer.writeUint8(static_cast<std::uint8_t>(section.size()));
+            writer.writeBytes(section.data(), section.size());
+        }
+
+        if (request.obstacles.size() > std::numeric_limits<std::uint16_t>::max())
+            throw std::invalid_argument("Too many obstacles to log the request.");
+        writer.writeUint16(static_cast<std::uint16_t>(request.obstacles.size()));
+        for (const auto &obstacle : request.obstacles)
+        {
+            writer.writeFloat(obstacle.getPosition().getX());
+            writer.writeFloat(obstacle.getPosition().getY());
+            writer.writeFloat(obstacle.getRadius());
+            writer.writeFloat(obstacle.getVelocity().getX());
+            writer.writeFloat(obstacle.getVelocity().getY());
+            writer.writeFloat(obstacle.getValidFrom());
+            writer.writeFloat(obstacle.getValidUntil());
+        }
+
+        writer.writeUint32(static_cast<std::uint32_t>(request.result.size()));
+        for (const auto &point : request.result)
+            writer.writeItineraryPoint(point);
+
+        strm_.write(reinterpret_cast<const char *>(buffer_.data()), buffer_.size());
+        strm_.flush();
+    }
+
+    RequestLogReader::RequestLogReader(std::istream &strm) :
+            reader_(strm, "Malformed request log. Unexpected end of file.")
+    {
+        char magic[sizeof(log_magic)];
+        strm.read(magic, sizeof(magic));
+        if (!strm || std::memcmp(magic, log_magic, sizeof(magic)) != 0)
+            throw std::invalid_argument("Not a Kraken request log.");
+        if (reader_.readUint8() != log_version)
+            throw std::invalid_argument("Unsupported request log version.");
+    }
+
+    bool RequestLogReader::read(PlanningRequest &request)
+    {
+        if (reader_.isAtEnd())
+            return false;
+
+        request.seed = reader_.readUint32();
+        request.start = reader_.readKinematic();
+        request.goal = reader_.readKinematic();
+
+        auto section_count = reader_.readUint8();
+        if (section_count != ConfigurationHandler::module_count)
+            throw std::invalid_argument("Malformed request log. Unexpected number of configuration modules.");
+        for (auto &section : request.sections)
+        {
+            section.assign(reader_.readUint8(), '\0');
+            reader_.readBytes(&section[0], section.size());
+        }
+
+        auto obstacle_count = reader_.readUint16();
+        request.obstacles.clear();
+        request.obstacles.reserve(obstacle_count);
+        for (std::uint16_t i = 0; i < obstacle_count; i++)
+        {
+            float x = reader_.readFloat();
+            float y = reader_.readFloat();
+            float radius = reader_.readFloat();
+            float velocity_x = reader_.readFloat();
+            float velocity_y = reader_.readFloat();
+            float valid_from = reader_.readFloat();
+            float valid_until = reader_.readFloat();
+            request.obstacles.emplace_back(Vector2D(x, y), radius, Vector2D(velocity_x, velocity_y), valid_from,
+                                           valid_until);
+        }
+
+        auto point_count = reader_.readUint32();
+        request.result.clear();
+        request.result.reserve(point_count);
+        for (std::uint32_t i = 0; i < point_count; i++)
+            request.result.push_back(reader_.readItineraryPoint());
+        return true;
+    }
+}
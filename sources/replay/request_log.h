@@ -0,0 +1,51 @@
+#ifndef KRAKEN_REQUEST_LOG_H
+#define KRAKEN_REQUEST_LOG_H
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "binary_codec.h"
+#include "../struct/planning_request.h"
+
+namespace kraken
+{
+    /*
+     * Binary log of planning requests.
+     * The file starts with the magic "KRKL" and a version byte, followed by the records, encoded as in binary_codec.h
+     * so that a log captured on the robot is replayed with the exact same inputs on a workstation. The obstacles are
+     * stored with their motion and their validity interval.
+     */
+    class RequestLogWriter
+    {
+    public:
+        explicit RequestLogWriter(std::ostream &strm);
+
+        void write(const PlanningRequest &request);
+
+    private:
+        std::ostream &strm_;
+        //A record is encoded then written at once
+        std::vector<std::uint8_t> buffer_;
+    };
+
+    class RequestLogReader
+    {
+    public:
+        explicit RequestLogReader(std::istream &strm);
+
+        /**
+         * Reads the next record of the log. Throws std::invalid_argument if the log is malformed.
+         * @param request
+         * @return false if there is no more record
+         */
+        bool read(PlanningRequest &request);
+
+    private:
+        BinaryReader reader_;
+    };
+}
+
+#endif //KRAKEN_REQUEST_LOG_H
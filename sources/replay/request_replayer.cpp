@@ -0,0 +1,90 @@
+#include "request_replayer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "request_log.h"
+#include "../instrumentation/search_statistics.h"
+
+namespace kraken
+{
+    RequestReplayer::RequestReplayer(ConfigurationHandler &configuration_handler,
+                                     PlanningFunction planning_function) :
+            configuration_handler_(configuration_handler), planning_function_(std::move(planning_function))
+    {
+
+    }
+
+    ReplayReport RequestReplayer::replay(std::istream &log)
+    {
+        ReplayReport report;
+        LatencyHistogram latency;
+        RequestLogReader reader(log);
+        PlanningRequest request;
+
+        while (reader.read(request))
+        {
+            request.applySections(configuration_handler_);
+
+            auto &statistics = search_statistics::local();
+            statistics.reset();
+            auto begin = std::chrono::steady_clock::now();
+            auto replayed = planning_function_(request);
+            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - begin);
+
+            ReplayedRequest replayed_request;
+            replayed_request.index = report.request_count++;
+            replayed_request.latency_us = static_cast<std::uint32_t>(duration.count());
+            compare(request.result, replayed, replayed_request);
+            latency.record(replayed_request.latency_us);
+            report.pool_high_water_mark = std::max(report.pool_high_water_mark, statistics.pool_high_water_mark);
+            report.obstacle_high_water_mark = std::max(report.obstacle_high_water_mark,
+                                                       statistics.obstacle_high_water_mark);
+            if (!replayed_request.identical)
+                report.mismatch_count++;
+            report.requests.push_back(replayed_request);
+        }
+
+        report.latency = latency.summarize();
+        return report;
+    }
+
+    void RequestReplayer::compare(const std::vector<ItineraryPoint> &recorded,
+                                  const std::vector<ItineraryPoint> &replayed, ReplayedRequest &replayed_request)
+    {
+        replayed_request.recorded_points = recorded.size();
+        replayed_request.replayed_points = replayed.size();
+        replayed_request.identical = recorded.size() == replayed.size();
+
+        float max_squared_deviation = 0;
+        for (std::size_t i = 0; i < recorded.size() && i < replayed.size(); i++)
+        {
+            if (!(recorded[i] == replayed[i]))
+                replayed_request.identical = false;
+            auto squared_deviation = recorded[i].getPosition().squaredDistance(replayed[i].getPosition());
+            if (squared_deviation > max_squared_deviation)
+                max_squared_deviation = squared_deviation;
+        }
+        replayed_request.max_deviation = std::sqrt(max_squared_deviation);
+    }
+
+    std::ostream &operator<<(std::ostream &strm, const ReplayReport &report)
+    {
+        strm << report.request_count << " requests replayed, " << report.mismatch_count << " mismatches, latency p50="
+             << report.latency.p50_us << "us p99=" << report.latency.p99_us << "us max=" << report.latency.max_us
+             << "us" << std::endl
+             << "pool high-water marks: " << report.pool_high_water_mark << " nodes, "
+             << report.obstacle_high_water_mark << " obstacles" << std::endl;
+        for (const auto &request : report.requests)
+        {
+            if (request.identical)
+                continue;
+            strm << "  request " << request.index << ": " << request.recorded_points << " recorded points, "
+                 << request.replayed_points << " replayed points, max deviation " << request.max_deviation
+                 << std::endl;
+        }
+        return strm;
+    }
+}
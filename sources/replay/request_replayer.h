@@ -0,0 +1,62 @@
+#ifndef KRAKEN_REQUEST_REPLAYER_H
+#define KRAKEN_REQUEST_REPLAYER_H
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include "../instrumentation/latency_histogram.h"
+#include "../struct/planning_request.h"
+
+namespace kraken
+{
+    using PlanningFunction = std::function<std::vector<ItineraryPoint>(const PlanningRequest &)>;
+
+    struct ReplayedRequest
+    {
+        std::uint32_t index = 0;
+        std::uint32_t latency_us = 0;
+        bool identical = false;
+        std::size_t recorded_points = 0;
+        std::size_t replayed_points = 0;
+        //Largest distance between two points of same index in the recorded and the replayed itineraries
+        float max_deviation = 0;
+    };
+
+    struct ReplayReport
+    {
+        std::uint32_t request_count = 0;
+        std::uint32_t mismatch_count = 0;
+        LatencySummary latency;
+        //Largest usage of the pools over the log, to size NodeMemoryPoolSize and ObstaclesMemoryPoolSize
+        std::uint32_t pool_high_water_mark = 0;
+        std::uint32_t obstacle_high_water_mark = 0;
+        std::vector<ReplayedRequest> requests;
+    };
+
+    /*
+     * Runs again every request of a log. The configuration sections recorded with a request are activated before
+     * it is planned. The pool usages are read from the statistics of the thread, the planning function has to plan
+     * on the calling thread.
+     */
+    class RequestReplayer
+    {
+    public:
+        RequestReplayer(ConfigurationHandler &configuration_handler, PlanningFunction planning_function);
+
+        ReplayReport replay(std::istream &log);
+
+    private:
+        static void compare(const std::vector<ItineraryPoint> &recorded, const std::vector<ItineraryPoint> &replayed,
+                            ReplayedRequest &replayed_request);
+
+        ConfigurationHandler &configuration_handler_;
+        PlanningFunction planning_function_;
+    };
+
+    std::ostream &operator<<(std::ostream &strm, const ReplayReport &report);
+}
+
+#endif //KRAKEN_REQUEST_REPLAYER_H
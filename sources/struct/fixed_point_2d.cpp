@@ -0,0 +1,114 @@
+#include "fixed_point_2d.h"
+#include <cmath>
+#include <algorithm>
+
+namespace kraken
+{
+    namespace
+    {
+        constexpr float micrometers_per_unit = 1000.f;
+    }
+
+    FixedPoint2D::FixedPoint2D() : x_(0), y_(0)
+    {
+
+    }
+
+    FixedPoint2D::FixedPoint2D(const std::int32_t &x, const std::int32_t &y) : x_(x), y_(y)
+    {
+
+    }
+
+    template<typename T>
+    FixedPoint2D::FixedPoint2D(const Vector2DT<T> &position) :
+            x_(static_cast<std::int32_t>(std::lround(position.getX() * static_cast<T>(micrometers_per_unit)))),
+            y_(static_cast<std::int32_t>(std::lround(position.getY() * static_cast<T>(micrometers_per_unit))))
+    {
+
+    }
+
+    template FixedPoint2D::FixedPoint2D(const Vector2DT<float> &position);
+    template FixedPoint2D::FixedPoint2D(const Vector2DT<double> &position);
+
+    FixedPoint2D FixedPoint2D::operator+(const FixedPoint2D &rhs) const
+    {
+        return FixedPoint2D(x_ + rhs.x_, y_ + rhs.y_);
+    }
+
+    FixedPoint2D FixedPoint2D::operator-(const FixedPoint2D &rhs) const
+    {
+        return FixedPoint2D(x_ - rhs.x_, y_ - rhs.y_);
+    }
+
+    bool FixedPoint2D::operator==(const FixedPoint2D &rhs) const
+    {
+        return x_ == rhs.x_ && y_ == rhs.y_;
+    }
+
+    bool FixedPoint2D::operator!=(const FixedPoint2D &rhs) const
+    {
+        return x_ != rhs.x_ || y_ != rhs.y_;
+    }
+
+    std::int64_t FixedPoint2D::dot(const FixedPoint2D &other) const
+    {
+        return static_cast<std::int64_t>(x_) * other.x_ + static_cast<std::int64_t>(y_) * other.y_;
+    }
+
+    std::int64_t FixedPoint2D::cross(const FixedPoint2D &other) const
+    {
+        return static_cast<std::int64_t>(x_) * other.y_ - static_cast<std::int64_t>(y_) * other.x_;
+    }
+
+    std::int64_t FixedPoint2D::squaredDistance(const FixedPoint2D &other) const
+    {
+        std::int64_t dx = x_ - other.x_, dy = y_ - other.y_;
+        return dx * dx + dy * dy;
+    }
+
+    std::int64_t FixedPoint2D::distanceOctile(const FixedPoint2D &other) const
+    {
+        std::int64_t dx = std::abs(static_cast<std::int64_t>(x_) - other.x_);
+        std::int64_t dy = std::abs(static_cast<std::int64_t>(y_) - other.y_);
+        return std::max(dx, dy) + 414 * std::min(dx, dy) / 1000;
+    }
+
+    Vector2D FixedPoint2D::toVector2D() const
+    {
+        return Vector2D(x_ / micrometers_per_unit, y_ / micrometers_per_unit);
+    }
+
+    std::int32_t FixedPoint2D::getX() const
+    {
+        return x_;
+    }
+
+    std::int32_t FixedPoint2D::getY() const
+    {
+        return y_;
+    }
+
+    int FixedPoint2D::orientation(const FixedPoint2D &a, const FixedPoint2D &b, const FixedPoint2D &c)
+    {
+        auto cross = (b - a).cross(c - a);
+        return (cross > 0) - (cross < 0);
+    }
+
+    bool FixedPoint2D::segmentIntersection(const FixedPoint2D &point_A1, const FixedPoint2D &point_A2,
+                                           const FixedPoint2D &point_B1, const FixedPoint2D &point_B2)
+    {
+        // Parallel segments are considered as not intersecting
+        if ((point_A2 - point_A1).cross(point_B2 - point_B1) == 0)
+            return false;
+
+        return orientation(point_A1, point_A2, point_B1) * orientation(point_A1, point_A2, point_B2) <= 0
+               && orientation(point_B1, point_B2, point_A1) * orientation(point_B1, point_B2, point_A2) <= 0;
+    }
+
+#if DEBUG
+    std::ostream &operator<<(std::ostream &strm, const FixedPoint2D &v)
+    {
+        return strm << "FixedPoint2D(" << v.x_ << "," << v.y_ << ")" << std::endl;
+    }
+#endif
+}
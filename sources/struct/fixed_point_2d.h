@@ -0,0 +1,74 @@
+#ifndef KRAKEN_FIXED_POINT_2D_H
+#define KRAKEN_FIXED_POINT_2D_H
+
+#include <cstdint>
+
+#if DEBUG
+#include <ostream>
+#endif
+
+#include "vector_2d.h"
+
+namespace kraken
+{
+    /*
+     * Point with integer coordinates in μm, the unit of Vector2D::distanceOctile.
+     * The predicates are computed on 64 bits integers : they are exact and give the same result on every target.
+     * A table of a few meters is far from the limits (coordinates on 32 bits, products on 64 bits).
+     */
+    class FixedPoint2D
+    {
+    public:
+        FixedPoint2D();
+        FixedPoint2D(const std::int32_t &x, const std::int32_t &y);
+
+        /**
+         * Rounds the coordinates of a Vector2D (in mm) to the nearest μm
+         * @param position
+         */
+        template<typename T>
+        explicit FixedPoint2D(const Vector2DT<T> &position);
+
+        FixedPoint2D operator+(const FixedPoint2D &rhs) const;
+        FixedPoint2D operator-(const FixedPoint2D &rhs) const;
+        bool operator==(const FixedPoint2D &rhs) const;
+        bool operator!=(const FixedPoint2D &rhs) const;
+
+        std::int64_t dot(const FixedPoint2D &other) const;
+        std::int64_t cross(const FixedPoint2D &other) const;
+        std::int64_t squaredDistance(const FixedPoint2D &other) const;
+
+        /**
+         * Same metric as Vector2D::distanceOctile, computed without float
+         * @param other
+         * @return the distance in μm
+         */
+        std::int64_t distanceOctile(const FixedPoint2D &other) const;
+
+        Vector2D toVector2D() const;
+
+        std::int32_t getX() const;
+        std::int32_t getY() const;
+
+        /**
+         * @return 1 if (a, b, c) turns counterclockwise, -1 if it turns clockwise, 0 if the points are aligned
+         */
+        static int orientation(const FixedPoint2D &a, const FixedPoint2D &b, const FixedPoint2D &c);
+
+        /**
+         * Same contract as Vector2D::segmentIntersection
+         */
+        static bool segmentIntersection(const FixedPoint2D &point_A1, const FixedPoint2D &point_A2,
+                                        const FixedPoint2D &point_B1, const FixedPoint2D &point_B2);
+
+    protected:
+        std::int32_t x_;
+        std::int32_t y_;
+
+#if DEBUG
+        friend std::ostream &operator<<(std::ostream &strm, const FixedPoint2D &v);
+#endif
+    };
+}
+
+#endif //KRAKEN_FIXED_POINT_2D_H
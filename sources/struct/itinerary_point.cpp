@@ -4,18 +4,19 @@
 
 namespace kraken
 {
-
-    ItineraryPoint::ItineraryPoint(const Vector2D &pos,
-                                   const float &orientation, const float &curvature,
-                                   const bool &going_forward, const float &max_speed,
-                                   const float &possible_speed, const bool &stop) :
+    template<typename T>
+    ItineraryPointT<T>::ItineraryPointT(const Vector2DT<T> &pos,
+                                        const T &orientation, const T &curvature,
+                                        const bool &going_forward, const T &max_speed,
+                                        const T &possible_speed, const bool &stop) :
             pos_(pos), orientation_(math_utils::computeNewOrientation(orientation)), curvature_(curvature),
             max_speed_(max_speed), possible_speed_(possible_speed), going_forward_(going_forward), stop_(stop)
     {
 
     }
 
-    bool ItineraryPoint::operator==(const ItineraryPoint &rhs) const
+    template<typename T>
+    bool ItineraryPointT<T>::operator==(const ItineraryPointT &rhs) const
     {
         return pos_ == rhs.pos_ && orientation_ == rhs.orientation_
                && curvature_ == rhs.curvature_ && going_forward_ == rhs.going_forward_
@@ -23,39 +24,71 @@ namespace kraken
                && stop_ == rhs.stop_;
     }
 
-    float ItineraryPoint::getX() const
+    template<typename T>
+    ItineraryPointT<T> ItineraryPointT<T>::getYsym() const
+    {
+        return ItineraryPointT(Vector2DT<T>(pos_.getX(), -pos_.getY()), -orientation_, -curvature_, going_forward_,
+                               max_speed_, possible_speed_, stop_);
+    }
+
+    template<typename T>
+    const Vector2DT<T> &ItineraryPointT<T>::getPosition() const
+    {
+        return pos_;
+    }
+
+    template<typename T>
+    T ItineraryPointT<T>::getX() const
     {
         return pos_.getX();
     }
 
-    float ItineraryPoint::getY() const
+    template<typename T>
+    T ItineraryPointT<T>::getY() const
     {
         return pos_.getY();
     }
 
-    float ItineraryPoint::getOrientation() const
+    template<typename T>
+    T ItineraryPointT<T>::getOrientation() const
     {
         return orientation_;
     }
 
-    float ItineraryPoint::getCurvature() const
+    template<typename T>
+    T ItineraryPointT<T>::getCurvature() const
     {
         return curvature_;
     }
 
-    bool ItineraryPoint::getGoingForward() const
+    template<typename T>
+    T ItineraryPointT<T>::getMaxSpeed() const
+    {
+        return max_speed_;
+    }
+
+    template<typename T>
+    T ItineraryPointT<T>::getPossibleSpeed() const
+    {
+        return possible_speed_;
+    }
+
+    template<typename T>
+    bool ItineraryPointT<T>::getGoingForward() const
     {
         return going_forward_;
     }
 
-    bool ItineraryPoint::getStop() const
+    template<typename T>
+    bool ItineraryPointT<T>::getStop() const
     {
         return stop_;
     }
 
 #if DEBUG
 
-    std::ostream &operator<<(std::ostream &strm, const ItineraryPoint &i)
+    template<typename T>
+    std::ostream &operator<<(std::ostream &strm, const ItineraryPointT<T> &i)
     {
         return strm << "ItineraryPoint(" << i.pos_ << ", o : " << i.orientation_
                     << (i.going_forward_ ? ", going forward" : ", going backward")
@@ -63,6 +96,11 @@ namespace kraken
                     << ", possible speed : " << i.possible_speed_ << (i.stop_ ? ", ending with a stop)" : ")");
     }
 
+    template std::ostream &operator<<(std::ostream &strm, const ItineraryPointT<float> &i);
+    template std::ostream &operator<<(std::ostream &strm, const ItineraryPointT<double> &i);
+
 #endif
 
+    template class ItineraryPointT<float>;
+    template class ItineraryPointT<double>;
 }
@@ -11,37 +11,54 @@
 
 namespace kraken
 {
-
-    class ItineraryPoint
+    /*
+     * Instantiated for float and double in itinerary_point.cpp, see Vector2DT
+     */
+    template<typename T>
+    class ItineraryPointT
     {
     public:
-        ItineraryPoint(const Vector2D &pos,
-                       const float &orientation, const float &curvature,
-                       const bool &going_forward, const float &max_speed,
-                       const float &possible_speed, const bool &stop);
+        ItineraryPointT(const Vector2DT<T> &pos,
+                        const T &orientation, const T &curvature,
+                        const bool &going_forward, const T &max_speed,
+                        const T &possible_speed, const bool &stop);
+
+        bool operator==(const ItineraryPointT &rhs) const;
 
-        bool operator==(const ItineraryPoint &rhs) const;
+        /**
+         * @return the point mirrored across the x axis, for the robot of the other team
+         */
+        ItineraryPointT getYsym() const;
 
-        float getX() const;
-        float getY() const;
-        float getOrientation() const;
-        float getCurvature() const;
+        const Vector2DT<T> &getPosition() const;
+        T getX() const;
+        T getY() const;
+        T getOrientation() const;
+        T getCurvature() const;
+        T getMaxSpeed() const;
+        T getPossibleSpeed() const;
         bool getGoingForward() const;
         bool getStop() const;
 
     private:
-        const Vector2D pos_;
-        const float orientation_;
-        const float curvature_;
-        const float max_speed_;
-        const float possible_speed_;
+        const Vector2DT<T> pos_;
+        const T orientation_;
+        const T curvature_;
+        const T max_speed_;
+        const T possible_speed_;
         const bool going_forward_;
         const bool stop_;
 
 #if DEBUG
-        friend std::ostream &operator<<(std::ostream &strm, const ItineraryPoint &v);
+        template<typename U>
+        friend std::ostream &operator<<(std::ostream &strm, const ItineraryPointT<U> &v);
 #endif
     };
+
+    using ItineraryPoint = ItineraryPointT<float>;
+
+    extern template class ItineraryPointT<float>;
+    extern template class ItineraryPointT<double>;
 }
 
 
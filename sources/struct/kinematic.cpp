@@ -1,51 +1,112 @@
 #include "kinematic.h"
 
 #include <cmath>
+#include "../utils/math_utils.h"
 
 namespace kraken
 {
-
-    Kinematic::Kinematic()
+    template<typename T>
+    KinematicT<T>::KinematicT()
             : position_(0, 0), geometric_orientation_(0), geometric_curvature_(0), real_orientation_(0),
               real_curvature_(0), go_forward_(true), stop_(false)
     {
 
     }
 
-    Kinematic::Kinematic(const float &x, const float &y, const float &orientation)
+    template<typename T>
+    KinematicT<T>::KinematicT(const T &x, const T &y, const T &orientation)
             : position_(x, y), geometric_orientation_(0), geometric_curvature_(0), real_orientation_(orientation),
               real_curvature_(0), go_forward_(true), stop_(false)
     {
         updateReal(x, y, orientation, 0);
     }
 
-    Kinematic::Kinematic(const float &x, const float &y, const float &orientation, const bool &go_forward,
-                         const float &curvature, const bool &stop)
+    template<typename T>
+    KinematicT<T>::KinematicT(const T &x, const T &y, const T &orientation, const bool &go_forward,
+                              const T &curvature, const bool &stop)
             : position_(x, y), geometric_orientation_(0), geometric_curvature_(0), real_orientation_(orientation),
               real_curvature_(0), go_forward_(true), stop_(false)
     {
         update(x, y, orientation, go_forward, curvature, stop);
     }
 
-    bool Kinematic::isSimilar(const Kinematic &rhs, const float &squaredDeltaPos,
-                              const float &deltaCurvature, const float &deltaOrientation) const
+    template<typename T>
+    bool KinematicT<T>::isSimilar(const KinematicT &rhs, const T &squaredDeltaPos,
+                                  const T &deltaCurvature, const T &deltaOrientation) const
     {
         return rhs.position_.squaredDistance(position_) < squaredDeltaPos
                && std::abs(real_curvature_ - rhs.real_curvature_) < deltaCurvature
-               && std::abs(real_orientation_ - rhs.real_orientation_) < deltaOrientation
-               // TODO : use angle_difference
+               && std::abs(math_utils::angleDifference(real_orientation_, rhs.real_orientation_)) < deltaOrientation
                && rhs.go_forward_ == go_forward_ && rhs.stop_ == stop_;
     }
 
-    void Kinematic::update(const ItineraryPoint &iP)
+    template<typename T>
+    KinematicT<T> &KinematicT<T>::Ysym(const bool &do_symmetry)
+    {
+        if (do_symmetry)
+        {
+            position_.Ysym(true);
+            geometric_orientation_ = -geometric_orientation_;
+            geometric_curvature_ = -geometric_curvature_;
+            real_orientation_ = -real_orientation_;
+            real_curvature_ = -real_curvature_;
+        }
+        return *this;
+    }
+
+    template<typename T>
+    const Vector2DT<T> &KinematicT<T>::getPosition() const
+    {
+        return position_;
+    }
+
+    template<typename T>
+    T KinematicT<T>::getGeometricOrientation() const
+    {
+        return geometric_orientation_;
+    }
+
+    template<typename T>
+    T KinematicT<T>::getGeometricCurvature() const
+    {
+        return geometric_curvature_;
+    }
+
+    template<typename T>
+    T KinematicT<T>::getRealOrientation() const
+    {
+        return real_orientation_;
+    }
+
+    template<typename T>
+    T KinematicT<T>::getRealCurvature() const
+    {
+        return real_curvature_;
+    }
+
+    template<typename T>
+    bool KinematicT<T>::getGoingForward() const
+    {
+        return go_forward_;
+    }
+
+    template<typename T>
+    bool KinematicT<T>::getStop() const
+    {
+        return stop_;
+    }
+
+    template<typename T>
+    void KinematicT<T>::update(const ItineraryPointT<T> &iP)
     {
         go_forward_ = iP.getGoingForward();
         updateReal(iP.getX(), iP.getY(), iP.getOrientation(), iP.getCurvature());
         stop_ = iP.getStop();
     }
 
-    void Kinematic::updateReal(const float &x, const float &y, const float &real_orientation,
-                               const float &real_curvature)
+    template<typename T>
+    void KinematicT<T>::updateReal(const T &x, const T &y, const T &real_orientation,
+                                    const T &real_curvature)
     {
         if (go_forward_)
         {
@@ -54,18 +115,19 @@ namespace kraken
         }
         else
         {
-            geometric_orientation_ = real_orientation + static_cast<float>(M_PI);
+            geometric_orientation_ = real_orientation + static_cast<T>(M_PI);
             geometric_curvature_ = -real_curvature;
         }
 
         position_.setX(x);
-        position_.setX(y);
+        position_.setY(y);
         real_orientation_ = real_orientation;
         real_curvature_ = real_curvature;
     }
 
-    void Kinematic::update(const float &x, const float &y, const float &geometric_orientation, const bool &go_forward,
-                           const float &geometric_curvature, const bool &stop)
+    template<typename T>
+    void KinematicT<T>::update(const T &x, const T &y, const T &geometric_orientation, const bool &go_forward,
+                                const T &geometric_curvature, const bool &stop)
     {
         if (go_forward)
         {
@@ -74,12 +136,12 @@ namespace kraken
         }
         else
         {
-            real_orientation_ = geometric_orientation + static_cast<float>(M_PI);
+            real_orientation_ = geometric_orientation + static_cast<T>(M_PI);
             real_curvature_ = -geometric_curvature;
         }
 
         position_.setX(x);
-        position_.setX(y);
+        position_.setY(y);
         geometric_orientation_ = geometric_orientation;
         geometric_curvature_ = geometric_curvature;
         go_forward_ = go_forward;
@@ -88,12 +150,19 @@ namespace kraken
 
 #if DEBUG
 
-    std::ostream &operator<<(std::ostream &strm, const kraken::Kinematic &v)
+    template<typename T>
+    std::ostream &operator<<(std::ostream &strm, const KinematicT<T> &v)
     {
         return strm << "Kinematic(" << v.position_.getX() << ", " << v.position_.getY() << ", orientation :"
                     << v.real_orientation_ << "," << (v.go_forward_ ? "going forward" : "going backward")
                     << ", curvate :" << v.real_curvature_ << (v.stop_ ? ")" : " stop)") << std::endl;
     }
 
+    template std::ostream &operator<<(std::ostream &strm, const KinematicT<float> &v);
+    template std::ostream &operator<<(std::ostream &strm, const KinematicT<double> &v);
+
 #endif
+
+    template class KinematicT<float>;
+    template class KinematicT<double>;
 }
@@ -6,38 +6,63 @@
 
 namespace kraken
 {
-    class Kinematic
+    /*
+     * Instantiated for float and double in kinematic.cpp, see Vector2DT
+     */
+    template<typename T>
+    class KinematicT
     {
     public:
-        Kinematic();
-        Kinematic(const float &x, const float &y, const float &orientation);
-        Kinematic(const float &x, const float &y, const float &orientation, const bool &go_forward,
-                  const float &curvature, const bool &stop);
+        KinematicT();
+        KinematicT(const T &x, const T &y, const T &orientation);
+        KinematicT(const T &x, const T &y, const T &orientation, const bool &go_forward,
+                   const T &curvature, const bool &stop);
 
-        void update(const ItineraryPoint &itineraryPoint);
-        void updateReal(const float &x, const float &y, const float &real_orientation, const float &real_curvature);
+        void update(const ItineraryPointT<T> &itineraryPoint);
+        void updateReal(const T &x, const T &y, const T &real_orientation, const T &real_curvature);
 
-        bool isSimilar(const Kinematic &rhs, const float &squaredDeltaPos,
-                       const float &deltaCurvature, const float &deltaOrientation) const;
+        bool isSimilar(const KinematicT &rhs, const T &squaredDeltaPos,
+                       const T &deltaCurvature, const T &deltaOrientation) const;
+
+        /**
+         * Mirror across the x axis, i.e. the kinematic state of the robot of the other team
+         * @param do_symmetry
+         * @return
+         */
+        KinematicT &Ysym(const bool &do_symmetry);
+
+        const Vector2DT<T> &getPosition() const;
+        T getGeometricOrientation() const;
+        T getGeometricCurvature() const;
+        T getRealOrientation() const;
+        T getRealCurvature() const;
+        bool getGoingForward() const;
+        bool getStop() const;
 
     protected:
-        void update(const float &x, const float &y, const float &geometric_orientation, const bool &go_forward,
-                    const float &geometric_curvature, const bool &stop);
+        void update(const T &x, const T &y, const T &geometric_orientation, const bool &go_forward,
+                    const T &geometric_curvature, const bool &stop);
     protected:
-        Vector2D position_;
-        float geometric_orientation_;
-        float geometric_curvature_;
+        Vector2DT<T> position_;
+        T geometric_orientation_;
+        T geometric_curvature_;
 
-        float real_orientation_;
-        float real_curvature_;
+        T real_orientation_;
+        T real_curvature_;
 
         bool go_forward_;
         bool stop_;
 
 #if DEBUG
-        friend std::ostream &operator<<(std::ostream &strm, const Kinematic &v);
+        template<typename U>
+        friend std::ostream &operator<<(std::ostream &strm, const KinematicT<U> &v);
 #endif
     };
+
+    using Kinematic = KinematicT<float>;
+
+    extern template class KinematicT<float>;
+    extern template class KinematicT<double>;
 }
 
 #endif //TESTS_KINEMATIC_H
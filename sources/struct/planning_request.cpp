@@ -0,0 +1,17 @@
+#include "planning_request.h"
+
+namespace kraken
+{
+    void PlanningRequest::captureSections(ConfigurationHandler &configuration_handler)
+    {
+        for (unsigned long i = 0; i < ConfigurationHandler::module_count; i++)
+            sections[i] = configuration_handler.getSectionName(static_cast<ConfigModule>(i));
+    }
+
+    void PlanningRequest::applySections(ConfigurationHandler &configuration_handler) const
+    {
+        ScopedConfigurationUpdate update(configuration_handler);
+        for (unsigned long i = 0; i < ConfigurationHandler::module_count; i++)
+            configuration_handler.changeModuleSection(static_cast<ConfigModule>(i), sections[i]);
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef KRAKEN_PLANNING_REQUEST_H
+#define KRAKEN_PLANNING_REQUEST_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "kinematic.h"
+#include "itinerary_point.h"
+#include "../obstacles/dynamic_obstacle.h"
+#include "../configuration/configuration_handler.h"
+
+namespace kraken
+{
+    /*
+     * Everything needed to run a planning request again: the inputs, the configuration sections that were active and
+     * the seed. The result of the original run is kept too, so that a replay can be compared to it.
+     */
+    struct PlanningRequest
+    {
+        Kinematic start;
+        Kinematic goal;
+        std::vector<DynamicObstacle> obstacles;
+        std::string sections[ConfigurationHandler::module_count];
+        std::uint32_t seed = 0;
+        std::vector<ItineraryPoint> result;
+
+        void captureSections(ConfigurationHandler &configuration_handler);
+        void applySections(ConfigurationHandler &configuration_handler) const;
+    };
+}
+
+#endif //KRAKEN_PLANNING_REQUEST_H
@@ -2,221 +2,278 @@
 #include <algorithm>
 #include <cassert>
 #include "vector_2d.h"
+#include "fixed_point_2d.h"
 
 namespace kraken
 {
-
-    Vector2D::Vector2D() : x_(0.f), y_(0.f)
+    template<typename T>
+    Vector2DT<T>::Vector2DT() : x_(0), y_(0)
     {
 
     }
 
-    Vector2D::Vector2D(const float &x, const float &y) : x_(x), y_(y)
+    template<typename T>
+    Vector2DT<T>::Vector2DT(const T &x, const T &y) : x_(x), y_(y)
     {
 
     }
 
-    Vector2D Vector2D::operator+(const Vector2D &rhs) const
+    template<typename T>
+    Vector2DT<T> Vector2DT<T>::operator+(const Vector2DT &rhs) const
     {
-        return Vector2D(x_ + rhs.x_, y_ + rhs.y_);
+        return Vector2DT(x_ + rhs.x_, y_ + rhs.y_);
     }
 
-    Vector2D &Vector2D::operator+=(const Vector2D &rhs)
+    template<typename T>
+    Vector2DT<T> &Vector2DT<T>::operator+=(const Vector2DT &rhs)
     {
         x_ += rhs.x_;
         y_ += rhs.y_;
         return *this;
     }
 
-    Vector2D Vector2D::operator-(const Vector2D &rhs) const
+    template<typename T>
+    Vector2DT<T> Vector2DT<T>::operator-(const Vector2DT &rhs) const
     {
-        return Vector2D(x_ - rhs.x_, y_ - rhs.y_);
+        return Vector2DT(x_ - rhs.x_, y_ - rhs.y_);
     }
 
-    Vector2D &Vector2D::operator-=(const Vector2D &rhs)
+    template<typename T>
+    Vector2DT<T> &Vector2DT<T>::operator-=(const Vector2DT &rhs)
     {
         x_ -= rhs.x_;
         y_ -= rhs.y_;
         return *this;
     }
 
-    Vector2D &Vector2D::operator*=(const float &d)
+    template<typename T>
+    Vector2DT<T> &Vector2DT<T>::operator*=(const T &d)
     {
         x_ *= d;
         y_ *= d;
         return *this;
     }
 
-    bool Vector2D::operator==(const Vector2D &rhs) const
+    template<typename T>
+    bool Vector2DT<T>::operator==(const Vector2DT &rhs) const
     {
         return x_ == rhs.x_ && y_ == rhs.y_;
     }
 
-    bool Vector2D::operator!=(const Vector2D &rhs) const
+    template<typename T>
+    bool Vector2DT<T>::operator!=(const Vector2DT &rhs) const
     {
         return x_ != rhs.x_ || y_ != rhs.y_;
     }
 
-    float Vector2D::dot(const Vector2D &other) const
+    template<typename T>
+    T Vector2DT<T>::dot(const Vector2DT &other) const
     {
         return x_ * other.x_ + y_ * other.y_;
     }
 
-    float Vector2D::squaredDistance(const Vector2D &other) const
+    template<typename T>
+    T Vector2DT<T>::squaredDistance(const Vector2DT &other) const
     {
-        float tmp_x = x_ - other.x_, tmp_y = y_ - other.y_;
+        T tmp_x = x_ - other.x_, tmp_y = y_ - other.y_;
         return tmp_x * tmp_x + tmp_y * tmp_y;
     }
 
-    float Vector2D::distance(const Vector2D &other) const
+    template<typename T>
+    T Vector2DT<T>::distance(const Vector2DT &other) const
     {
         return std::sqrt(squaredDistance(other));
     }
 
-    float Vector2D::distanceFast(const Vector2D &other) const
+    template<typename T>
+    T Vector2DT<T>::distanceFast(const Vector2DT &other) const
     {
-        float dx = std::abs(x_ - other.x_);
-        float dy = std::abs(y_ - other.y_);
-        return std::max(dx, dy) + 0.414f * std::min(dx, dy);
+        T dx = std::abs(x_ - other.x_);
+        T dy = std::abs(y_ - other.y_);
+        return std::max(dx, dy) + static_cast<T>(0.414) * std::min(dx, dy);
     }
 
-    Vector2D &Vector2D::Ysym(const bool &do_symmetry)
+    template<typename T>
+    Vector2DT<T> &Vector2DT<T>::Ysym(const bool &do_symmetry)
     {
         if (do_symmetry)
             y_ = -y_;
         return *this;
     }
 
-    Vector2D Vector2D::rotate(const float &angle, const Vector2D &rotation_center) const
+    template<typename T>
+    Vector2DT<T> Vector2DT<T>::rotate(const T &angle, const Vector2DT &rotation_center) const
     {
-        float cos = std::cos(angle);
-        float sin = std::sin(angle);
-        float x = cos * (x_ - rotation_center.x_) - sin * (y_ - rotation_center.y_) + rotation_center.x_;
-        float y = sin * (x_ - rotation_center.x_) + cos * (y_ - rotation_center.y_) + rotation_center.y_;
-        return Vector2D(x, y);
+        T cos = std::cos(angle);
+        T sin = std::sin(angle);
+        T x = cos * (x_ - rotation_center.x_) - sin * (y_ - rotation_center.y_) + rotation_center.x_;
+        T y = sin * (x_ - rotation_center.x_) + cos * (y_ - rotation_center.y_) + rotation_center.y_;
+        return Vector2DT(x, y);
     }
 
-    void Vector2D::rotate(const float &angle, const Vector2D &rotation_center)
+    template<typename T>
+    void Vector2DT<T>::rotate(const T &angle, const Vector2DT &rotation_center)
     {
-        float cos = std::cos(angle);
-        float sin = std::sin(angle);
-        float tmp_x = cos * (x_ - rotation_center.x_) - sin * (y_ - rotation_center.y_) + rotation_center.x_;
+        T cos = std::cos(angle);
+        T sin = std::sin(angle);
+        T tmp_x = cos * (x_ - rotation_center.x_) - sin * (y_ - rotation_center.y_) + rotation_center.x_;
         y_ = sin * (x_ - rotation_center.x_) + cos * (y_ - rotation_center.y_) + rotation_center.y_;
         x_ = tmp_x;
     }
 
-    Vector2D &Vector2D::rotate(const float &angle)
+    template<typename T>
+    Vector2DT<T> &Vector2DT<T>::rotate(const T &angle)
     {
-        float cos = std::cos(angle);
-        float sin = std::sin(angle);
-        float old_x = x_;
+        T cos = std::cos(angle);
+        T sin = std::sin(angle);
+        T old_x = x_;
         x_ = cos * x_ - sin * y_;
         y_ = sin * old_x + cos * y_;
         return *this;
     }
 
-    Vector2D &Vector2D::rotate(const float &cos, const float &sin)
+    template<typename T>
+    Vector2DT<T> &Vector2DT<T>::rotate(const T &cos, const T &sin)
     {
-        assert(std::abs(1 - cos * cos - sin * sin) < 0.01f);
-        float old_x = x_;
+        assert(std::abs(1 - cos * cos - sin * sin) < static_cast<T>(0.01));
+        T old_x = x_;
         x_ = cos * x_ - sin * y_;
         y_ = sin * old_x + cos * y_;
         return *this;
     }
 
-    float Vector2D::getArgument() const
+    template<typename T>
+    T Vector2DT<T>::getArgument() const
     {
         return std::atan2(y_, x_);
     }
 
-    float Vector2D::getFastArgument() const
+    template<typename T>
+    T Vector2DT<T>::getFastArgument() const
     {
         // http://math.stackexchange.com/questions/1098487/atan2-faster-approximation
-        double a = std::min(std::abs(x_), std::abs(y_)) / std::max(std::abs(x_), std::abs(y_));
-        double s = a * a;
-        double r = ((-0.0464964749 * s + 0.15931422) * s - 0.327622764) * s * a + a;
+        T a = std::min(std::abs(x_), std::abs(y_)) / std::max(std::abs(x_), std::abs(y_));
+        T s = a * a;
+        T r = ((static_cast<T>(-0.0464964749) * s + static_cast<T>(0.15931422)) * s
+               - static_cast<T>(0.327622764)) * s * a + a;
         if (std::abs(y_) > std::abs(x_))
-            r = 1.57079637 - r;
+            r = static_cast<T>(M_PI / 2) - r;
         if (x_ < 0)
-            r = 3.14159274 - r;
+            r = static_cast<T>(M_PI) - r;
         if (y_ < 0)
             r = -r;
-        return static_cast<float>(r);
+        return r;
     }
 
-    float Vector2D::squaredNorm() const
+    template<typename T>
+    T Vector2DT<T>::squaredNorm() const
     {
         return x_ * x_ + y_ * y_;
     }
 
-    float Vector2D::norm() const
+    template<typename T>
+    T Vector2DT<T>::norm() const
     {
         return std::sqrt(squaredNorm());
     }
 
-    int Vector2D::distanceOctile(const Vector2D &other) const
+    template<typename T>
+    int Vector2DT<T>::distanceOctile(const Vector2DT &other) const
     {
-        float dx = std::abs(x_ - other.x_);
-        float dy = std::abs(y_ - other.y_);
+        T dx = std::abs(x_ - other.x_);
+        T dy = std::abs(y_ - other.y_);
         return static_cast<int>(1000 * std::max(dx, dy) + 414 * std::min(dx, dy));
     }
 
-    float Vector2D::getX() const
+    template<typename T>
+    T Vector2DT<T>::getX() const
     {
         return x_;
     }
 
-    float Vector2D::getY() const
+    template<typename T>
+    T Vector2DT<T>::getY() const
     {
         return y_;
     }
 
-    void Vector2D::setX(float x)
+    template<typename T>
+    void Vector2DT<T>::setX(T x)
     {
         x_ = x;
     }
 
-    void Vector2D::setY(float y)
+    template<typename T>
+    void Vector2DT<T>::setY(T y)
     {
         y_ = y;
     }
 
-    bool Vector2D::segmentIntersection(Vector2D &point_A1, Vector2D &point_A2, Vector2D &point_B1, Vector2D &point_B2)
+    template<typename T>
+    bool Vector2DT<T>::segmentIntersection(const Vector2DT &point_A1, const Vector2DT &point_A2,
+                                       const Vector2DT &point_B1, const Vector2DT &point_B2)
     {
+#if FIXED_POINT_GEOMETRY
+        return FixedPoint2D::segmentIntersection(FixedPoint2D(point_A1), FixedPoint2D(point_A2),
+                                                 FixedPoint2D(point_B1), FixedPoint2D(point_B2));
+#else
         // Source : https://stackoverflow.com/questions/3746274/line-intersection-with-aabb-rectangle
 
-        Vector2D b = point_A2 - point_A1;
-        Vector2D d = point_B2 - point_B1;
-        float bDotDPerp = b.x_ * d.y_ - b.y_ * d.x_;
+        Vector2DT b = point_A2 - point_A1;
+        Vector2DT d = point_B2 - point_B1;
+        T bDotDPerp = b.x_ * d.y_ - b.y_ * d.x_;
 
         // if b dot d == 0, it means the lines are parallel so have infinite intersection points
         if (bDotDPerp == 0)
             return false;
 
-        Vector2D c = point_B1 - point_A1;
-        float t = (c.x_ * d.y_ - c.y_ * d.x_) / bDotDPerp;
-        if (t < 0 || t > 1)
-            return false;
+        Vector2DT c = point_B1 - point_A1;
+        T tNumerator = c.x_ * d.y_ - c.y_ * d.x_;
+        T uNumerator = c.x_ * b.y_ - c.y_ * b.x_;
 
-        float u = (c.x_ * b.y_ - c.y_ * b.x_) / bDotDPerp;
+        // t = tNumerator / bDotDPerp and u = uNumerator / bDotDPerp must be in [0, 1].
+        // The numerators are compared to the denominator instead, to avoid the divisions.
+        if (bDotDPerp < 0)
+        {
+            bDotDPerp = -bDotDPerp;
+            tNumerator = -tNumerator;
+            uNumerator = -uNumerator;
+        }
 
-        if (u < 0 || u > 1)
-            return false;
+        return tNumerator >= 0 && tNumerator <= bDotDPerp && uNumerator >= 0 && uNumerator <= bDotDPerp;
+#endif
+    }
 
-        return true;
+    template<typename T>
+    int Vector2DT<T>::orientation(const Vector2DT &a, const Vector2DT &b, const Vector2DT &c)
+    {
+#if FIXED_POINT_GEOMETRY
+        return FixedPoint2D::orientation(FixedPoint2D(a), FixedPoint2D(b), FixedPoint2D(c));
+#else
+        T cross = (b.x_ - a.x_) * (c.y_ - a.y_) - (b.y_ - a.y_) * (c.x_ - a.x_);
+        return (cross > 0) - (cross < 0);
+#endif
     }
 
-    Vector2D Vector2D::fromPolar(float radius, float angle)
+    template<typename T>
+    Vector2DT<T> Vector2DT<T>::fromPolar(T radius, T angle)
     {
-        float x = std::cos(angle) * radius;
-        float y = std::sin(angle) * radius;
-        return Vector2D(x, y);
+        T x = std::cos(angle) * radius;
+        T y = std::sin(angle) * radius;
+        return Vector2DT(x, y);
     }
 
 #if DEBUG
-    std::ostream &operator<<(std::ostream &strm, const Vector2D &v)
+    template<typename T>
+    std::ostream &operator<<(std::ostream &strm, const Vector2DT<T> &v)
     {
         return strm << "Vector2D(" << v.x_ << "," << v.y_ << ")" << std::endl;
     }
+
+    template std::ostream &operator<<(std::ostream &strm, const Vector2DT<float> &v);
+    template std::ostream &operator<<(std::ostream &strm, const Vector2DT<double> &v);
 #endif
+
+    template class Vector2DT<float>;
+    template class Vector2DT<double>;
 }
\ No newline at end of file
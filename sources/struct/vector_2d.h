@@ -7,47 +7,58 @@
 
 namespace kraken
 {
-
-    class Vector2D
+    /*
+     * 2D vector with T coordinates : float for the online search, double for offline precomputations.
+     * Both are instantiated in vector_2d.cpp.
+     */
+    template<typename T>
+    class Vector2DT
     {
     public:
-        Vector2D();
-        Vector2D(const float &x, const float &y);
+        Vector2DT();
+        Vector2DT(const T &x, const T &y);
+
+        template<typename U>
+        explicit Vector2DT(const Vector2DT<U> &other) :
+                x_(static_cast<T>(other.getX())), y_(static_cast<T>(other.getY()))
+        {
 
-        Vector2D operator+(const Vector2D &rhs) const;
-        Vector2D &operator+=(const Vector2D &rhs);
-        Vector2D operator-(const Vector2D &rhs) const;
-        Vector2D &operator-=(const Vector2D &rhs);
-        Vector2D &operator*=(const float &d);
-        bool operator==(const Vector2D &rhs) const;
-        bool operator!=(const Vector2D &rhs) const;
-        float dot(const Vector2D &other) const;
+        }
 
-        float squaredDistance(const Vector2D &other) const;
-        float distance(const Vector2D &other) const;
-        float distanceFast(const Vector2D &other) const;
-        Vector2D &Ysym(const bool &do_symmetry);
-        Vector2D rotate(const float &angle, const Vector2D &rotation_center) const;
-        void rotate(const float &angle, const Vector2D &rotation_center);
-        Vector2D &rotate(const float &angle);
-        Vector2D &rotate(const float &cos, const float &sin);
-        float getArgument() const;
-        float getFastArgument() const;
-        float squaredNorm() const;
-        float norm() const;
+        Vector2DT operator+(const Vector2DT &rhs) const;
+        Vector2DT &operator+=(const Vector2DT &rhs);
+        Vector2DT operator-(const Vector2DT &rhs) const;
+        Vector2DT &operator-=(const Vector2DT &rhs);
+        Vector2DT &operator*=(const T &d);
+        bool operator==(const Vector2DT &rhs) const;
+        bool operator!=(const Vector2DT &rhs) const;
+        T dot(const Vector2DT &other) const;
+
+        T squaredDistance(const Vector2DT &other) const;
+        T distance(const Vector2DT &other) const;
+        T distanceFast(const Vector2DT &other) const;
+        Vector2DT &Ysym(const bool &do_symmetry);
+        Vector2DT rotate(const T &angle, const Vector2DT &rotation_center) const;
+        void rotate(const T &angle, const Vector2DT &rotation_center);
+        Vector2DT &rotate(const T &angle);
+        Vector2DT &rotate(const T &cos, const T &sin);
+        T getArgument() const;
+        T getFastArgument() const;
+        T squaredNorm() const;
+        T norm() const;
 
         /**
          * The distance is in μm !
          * @param other
          * @return
          */
-        int distanceOctile(const Vector2D &other) const;
+        int distanceOctile(const Vector2DT &other) const;
 
-        float getX() const;
-        float getY() const;
+        T getX() const;
+        T getY() const;
 
-        void setX(float x);
-        void setY(float y);
+        void setX(T x);
+        void setY(T y);
     public:
         /**
          * Returns true iff the segment (pointA1, pointA2) intersects the segment (pointB1, pointB2)
@@ -57,16 +68,29 @@ namespace kraken
          * @param pointB2
          * @return
          */
-        static bool segmentIntersection(Vector2D &pointA1, Vector2D &pointA2, Vector2D &pointB1, Vector2D &pointB2);
-        static Vector2D fromPolar(float radius, float angle);
+        static bool segmentIntersection(const Vector2DT &pointA1, const Vector2DT &pointA2,
+                                        const Vector2DT &pointB1, const Vector2DT &pointB2);
+
+        /**
+         * Exact when FIXED_POINT_GEOMETRY is enabled
+         * @return 1 if (a, b, c) turns counterclockwise, -1 if it turns clockwise, 0 if the points are aligned
+         */
+        static int orientation(const Vector2DT &a, const Vector2DT &b, const Vector2DT &c);
+        static Vector2DT fromPolar(T radius, T angle);
     protected:
-        float x_;
-        float y_;
+        T x_;
+        T y_;
 
 #if DEBUG
-        friend std::ostream &operator<<(std::ostream &strm, const Vector2D &v);
+        template<typename U>
+        friend std::ostream &operator<<(std::ostream &strm, const Vector2DT<U> &v);
 #endif
     };
+
+    using Vector2D = Vector2DT<float>;
+
+    extern template class Vector2DT<float>;
+    extern template class Vector2DT<double>;
 }
 
 #endif //KRAKEN_VECTOR_2D_H
@@ -0,0 +1,154 @@
+#include "tentacle_library.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "../configuration/configuration_handler.h"
+
+namespace kraken
+{
+    namespace
+    {
+        constexpr int integration_steps_per_point = 16;
+        constexpr double millimeters_per_meter = 1000.;
+    }
+
+    TentacleLibrary::TentacleLibrary(ConfigurationHandler &configuration_handler) :
+            TentacleLibrary(configuration_handler.get<float>(ConfigKey::MaxCurvature),
+                            configuration_handler.get<float>(ConfigKey::MaxCurvatureDerivative),
+                            configuration_handler.get<float>(ConfigKey::PrecisionTrace),
+                            configuration_handler.get<int>(ConfigKey::NbPoints),
+                            // The curvature changes of one step along a tentacle
+                            configuration_handler.get<float>(ConfigKey::MaxCurvatureDerivative)
+                            * configuration_handler.get<float>(ConfigKey::PrecisionTrace)
+                            * configuration_handler.get<int>(ConfigKey::NbPoints))
+    {
+
+    }
+
+    TentacleLibrary::TentacleLibrary(float max_curvature, float max_curvature_derivative, float precision_trace,
+                                     int nb_points, float curvature_step) :
+            max_curvature_index_(std::max(1, static_cast<int>(std::round(max_curvature / curvature_step)))),
+            max_index_jump_(std::max(1, static_cast<int>(
+                    max_curvature_derivative * precision_trace * nb_points / curvature_step + 1e-3f))),
+            curvature_step_(max_curvature / max_curvature_index_), nb_points_(nb_points),
+            length_(static_cast<float>(precision_trace * nb_points * millimeters_per_meter))
+    {
+        first_stored_.reserve(max_curvature_index_ + 2);
+        std::size_t stored = 0;
+        for (int from = 0; from <= max_curvature_index_; from++)
+        {
+            first_stored_.push_back(stored);
+            int lowest = from == 0 ? 0 : std::max(-max_curvature_index_, from - max_index_jump_);
+            int highest = std::min(max_curvature_index_, from + max_index_jump_);
+            stored += highest - lowest + 1;
+        }
+        first_stored_.push_back(stored);
+
+        generate(max_curvature_derivative, precision_trace);
+    }
+
+    int TentacleLibrary::getMaxCurvatureIndex() const
+    {
+        return max_curvature_index_;
+    }
+
+    int TentacleLibrary::getMaxIndexJump() const
+    {
+        return max_index_jump_;
+    }
+
+    float TentacleLibrary::getCurvature(int curvature_index) const
+    {
+        return curvature_index * curvature_step_;
+    }
+
+    int TentacleLibrary::getNearestCurvatureIndex(float curvature) const
+    {
+        auto index = static_cast<int>(std::round(curvature / curvature_step_));
+        return std::max(-max_curvature_index_, std::min(max_curvature_index_, index));
+    }
+
+    bool TentacleLibrary::isReachable(int from_index, int to_index) const
+    {
+        return std::abs(from_index) <= max_curvature_index_ && std::abs(to_index) <= max_curvature_index_
+               && std::abs(to_index - from_index) <= max_index_jump_;
+    }
+
+    int TentacleLibrary::getPointCount() const
+    {
+        return nb_points_;
+    }
+
+    float TentacleLibrary::getLength() const
+    {
+        return length_;
+    }
+
+    TentaclePoint TentacleLibrary::getPoint(int from_index, int to_index, int point_index) const
+    {
+        assert(isReachable(from_index, to_index) && point_index >= 0 && point_index < nb_points_);
+        bool mirrored = from_index < 0 || (from_index == 0 && to_index < 0);
+        if (!mirrored)
+            return points_[getStoredIndex(from_index, to_index) * nb_points_ + point_index];
+
+        TentaclePoint point = points_[getStoredIndex(-from_index, -to_index) * nb_points_ + point_index];
+        point.position.Ysym(true);
+        point.orientation = -point.orientation;
+        point.curvature = -point.curvature;
+        return point;
+    }
+
+    std::size_t TentacleLibrary::getStoredTentacleCount() const
+    {
+        return first_stored_.back();
+    }
+
+    std::size_t TentacleLibrary::getStoredIndex(int from_index, int to_index) const
+    {
+        int lowest = from_index == 0 ? 0 : std::max(-max_curvature_index_, from_index - max_index_jump_);
+        return first_stored_[from_index] + (to_index - lowest);
+    }
+
+    void TentacleLibrary::generate(float max_curvature_derivative, float precision_trace)
+    {
+        // The integration is done in double and in meters, the result is stored in float and in mm
+        points_.resize(getStoredTentacleCount() * nb_points_);
+        const double step = static_cast<double>(precision_trace) / integration_steps_per_point;
+        const double curvature_delta = max_curvature_derivative * step;
+
+        for (int from = 0; from <= max_curvature_index_; from++)
+        {
+            int lowest = from == 0 ? 0 : std::max(-max_curvature_index_, from - max_index_jump_);
+            int highest = std::min(max_curvature_index_, from + max_index_jump_);
+            for (int to = lowest; to <= highest; to++)
+            {
+                Vector2DT<double> position;
+                double orientation = 0;
+                double curvature = getCurvature(from);
+                const double target_curvature = getCurvature(to);
+                auto tentacle = &points_[getStoredIndex(from, to) * nb_points_];
+
+                for (int point = 0; point < nb_points_; point++)
+                {
+                    for (int i = 0; i < integration_steps_per_point; i++)
+                    {
+                        double next_curvature = curvature < target_curvature
+                                                ? std::min(target_curvature, curvature + curvature_delta)
+                                                : std::max(target_curvature, curvature - curvature_delta);
+                        // Midpoint rule
+                        double middle_orientation = orientation + (curvature + next_curvature) * step / 4;
+                        position += Vector2DT<double>::fromPolar(step, middle_orientation);
+                        orientation += (curvature + next_curvature) * step / 2;
+                        curvature = next_curvature;
+                    }
+                    Vector2DT<double> position_mm = position;
+                    position_mm *= millimeters_per_meter;
+                    tentacle[point] = {Vector2D(position_mm), static_cast<float>(orientation),
+                                       static_cast<float>(curvature)};
+                }
+            }
+        }
+    }
+}
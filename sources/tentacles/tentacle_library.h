@@ -0,0 +1,80 @@
+#ifndef KRAKEN_TENTACLE_LIBRARY_H
+#define KRAKEN_TENTACLE_LIBRARY_H
+
+#include <cstddef>
+#include <vector>
+
+#include "../struct/vector_2d.h"
+
+namespace kraken
+{
+    class ConfigurationHandler;
+
+    /*
+     * A point of a tentacle, relatively to the pose where the tentacle starts (position (0, 0), orientation 0).
+     * The orientation and the curvature are geometric : a backward tentacle is a forward one followed with the
+     * opposite real orientation.
+     */
+    struct TentaclePoint
+    {
+        Vector2D position;
+        float orientation;
+        float curvature;
+    };
+
+    /*
+     * Precomputed clothoid tentacles.
+     * The curvatures are discretized in 2 * K + 1 values (index -K to K). A tentacle goes from a curvature index to
+     * another one, its curvature changing at MaxCurvatureDerivative, and is sampled every PrecisionTrace.
+     * The tentacle (-i -> -j) is the mirror of (i -> j) by Vector2D::Ysym, so only the tentacles starting with a
+     * nonnegative curvature are stored and the other half is derived when read.
+     */
+    class TentacleLibrary
+    {
+    public:
+        explicit TentacleLibrary(ConfigurationHandler &configuration_handler);
+
+        /**
+         * @param max_curvature in m^-1
+         * @param max_curvature_derivative in m^-2
+         * @param precision_trace distance between two points, in m
+         * @param nb_points number of points of a tentacle
+         * @param curvature_step difference between two discrete curvatures, in m^-1
+         */
+        TentacleLibrary(float max_curvature, float max_curvature_derivative, float precision_trace, int nb_points,
+                        float curvature_step);
+
+        int getMaxCurvatureIndex() const;
+        int getMaxIndexJump() const;
+        float getCurvature(int curvature_index) const;
+        int getNearestCurvatureIndex(float curvature) const;
+        bool isReachable(int from_index, int to_index) const;
+
+        int getPointCount() const;
+
+        /**
+         * The tentacle length, in mm
+         */
+        float getLength() const;
+
+        TentaclePoint getPoint(int from_index, int to_index, int point_index) const;
+
+        std::size_t getStoredTentacleCount() const;
+
+    private:
+        void generate(float max_curvature_derivative, float precision_trace);
+        std::size_t getStoredIndex(int from_index, int to_index) const;
+
+        int max_curvature_index_;
+        int max_index_jump_;
+        float curvature_step_;
+        int nb_points_;
+        float length_;
+
+        //first_stored_[i] is the number of tentacles stored before the ones starting at index i
+        std::vector<std::size_t> first_stored_;
+        std::vector<TentaclePoint> points_;
+    };
+}
+
+#endif //KRAKEN_TENTACLE_LIBRARY_H
@@ -0,0 +1,80 @@
+#include "speed_profile.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../instrumentation/search_statistics.h"
+#include "../instrumentation/trace_recorder.h"
+
+namespace kraken
+{
+    namespace
+    {
+        constexpr float meters_per_millimeter = 0.001f;
+    }
+
+    void speed_profile::build(const std::vector<PathSample> &samples, const float &max_speed,
+                              const float &max_lateral_acceleration, const float &max_linear_acceleration,
+                              std::vector<ItineraryPoint> &itinerary)
+    {
+        ScopedPhaseTimer timer(PlanningPhase::SpeedProfile);
+        ScopedTrace trace(PlanningPhase::SpeedProfile);
+
+        // The speeds are stored squared during the passes
+        static thread_local std::vector<float> max_speeds;
+        static thread_local std::vector<float> possible_speeds;
+        max_speeds.resize(samples.size());
+        possible_speeds.resize(samples.size());
+
+        for (std::size_t i = 0; i < samples.size(); i++)
+        {
+            float curvature = std::abs(samples[i].curvature);
+            float squared_speed = max_speed * max_speed;
+            if (curvature * squared_speed > max_lateral_acceleration)
+                squared_speed = max_lateral_acceleration / curvature;
+            max_speeds[i] = squared_speed;
+            possible_speeds[i] = samples[i].stop || i + 1 == samples.size() ? 0 : squared_speed;
+        }
+
+        // Acceleration pass, then braking pass
+        if (!samples.empty())
+            possible_speeds[0] = 0;
+        for (std::size_t i = 1; i < samples.size(); i++)
+        {
+            float distance = samples[i].position.distance(samples[i - 1].position) * meters_per_millimeter;
+            possible_speeds[i] = std::min(possible_speeds[i],
+                                          possible_speeds[i - 1] + 2 * max_linear_acceleration * distance);
+        }
+        for (std::size_t i = samples.size() - 1; i-- > 0;)
+        {
+            float distance = samples[i + 1].position.distance(samples[i].position) * meters_per_millimeter;
+            possible_speeds[i] = std::min(possible_speeds[i],
+                                          possible_speeds[i + 1] + 2 * max_linear_acceleration * distance);
+        }
+
+        itinerary.reserve(itinerary.size() + samples.size());
+        for (std::size_t i = 0; i < samples.size(); i++)
+        {
+            const auto &sample = samples[i];
+            itinerary.emplace_back(sample.position, sample.orientation, sample.curvature, sample.going_forward,
+                                   std::sqrt(max_speeds[i]), std::sqrt(possible_speeds[i]),
+                                   sample.stop || i + 1 == samples.size());
+        }
+    }
+
+    void speed_profile::computeArrivalTimes(const std::vector<ItineraryPoint> &itinerary, const float &start_time,
+                                            const float &minimal_speed, std::vector<float> &arrival_times)
+    {
+        arrival_times.resize(itinerary.size());
+        if (itinerary.empty())
+            return;
+
+        arrival_times[0] = start_time;
+        for (std::size_t i = 1; i < itinerary.size(); i++)
+        {
+            float distance = itinerary[i].getPosition().distance(itinerary[i - 1].getPosition());
+            float mean_speed = (itinerary[i].getPossibleSpeed() + itinerary[i - 1].getPossibleSpeed()) / 2;
+            arrival_times[i] = arrival_times[i - 1] + distance / std::max(mean_speed, minimal_speed);
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef KRAKEN_SPEED_PROFILE_H
+#define KRAKEN_SPEED_PROFILE_H
+
+#include <vector>
+
+#include "../struct/itinerary_point.h"
+
+namespace kraken
+{
+    /*
+     * A point of a path before its speed profile is computed. The orientation and the curvature are real ones,
+     * as in ItineraryPoint.
+     */
+    struct PathSample
+    {
+        Vector2D position;
+        float orientation;
+        float curvature;
+        bool going_forward;
+        bool stop;
+    };
+
+    namespace speed_profile
+    {
+        /**
+         * Computes the maximal and the possible speed of every sample and appends the resulting points to the itinerary.
+         * The maximal speed is limited by the lateral acceleration, the possible speed also by the linear
+         * acceleration : the robot starts from rest and stops at the samples marked as a stop and at the end.
+         * @param samples
+         * @param max_speed in m/s
+         * @param max_lateral_acceleration in m/s^2
+         * @param max_linear_acceleration in m/s^2
+         * @param itinerary output
+         */
+        void build(const std::vector<PathSample> &samples, const float &max_speed,
+                   const float &max_lateral_acceleration, const float &max_linear_acceleration,
+                   std::vector<ItineraryPoint> &itinerary);
+
+        /**
+         * Computes the time at which each point of the itinerary is reached, from the possible speed of the points.
+         * The speeds are in m/s, i.e. mm/ms, and the times in ms.
+         * @param itinerary
+         * @param start_time the time of the first point
+         * @param minimal_speed lower bound of the speed used between two points, so that a stop doesn't last forever
+         * @param arrival_times output, resized to the size of the itinerary
+         */
+        void computeArrivalTimes(const std::vector<ItineraryPoint> &itinerary, const float &start_time,
+                                 const float &minimal_speed, std::vector<float> &arrival_times);
+    }
+}
+
+#endif //KRAKEN_SPEED_PROFILE_H
@@ -0,0 +1,143 @@
+#include "tracking_monitor.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../utils/math_utils.h"
+
+namespace kraken
+{
+    namespace
+    {
+        constexpr float meters_per_millimeter = 0.001f;
+    }
+
+    TrackingMonitor::TrackingMonitor(float margin_before_collision, float horizon) :
+            margin_before_collision_(margin_before_collision), horizon_(horizon), cursor_(0),
+            replan_requested_(false), lateral_error_(0), heading_error_(0), curvature_error_(0)
+    {
+
+    }
+
+    void TrackingMonitor::reset(const std::vector<ItineraryPoint> &itinerary)
+    {
+        // ItineraryPoint is not assignable, the points are copied in the kept buffer
+        itinerary_.clear();
+        for (const auto &point : itinerary)
+            itinerary_.push_back(point);
+        cursor_ = 0;
+        replan_requested_ = false;
+        lateral_error_ = 0;
+        heading_error_ = 0;
+        curvature_error_ = 0;
+    }
+
+    TrackingStatus TrackingMonitor::update(const Kinematic &state)
+    {
+        if (itinerary_.size() < 2)
+            return TrackingStatus::Finished;
+
+        // Moves to the next segments while they are not farther than the current one
+        const auto &position = state.getPosition();
+        float squared_distance;
+        float ratio = project(cursor_, position, squared_distance);
+        while (cursor_ + 2 < itinerary_.size())
+        {
+            float next_squared_distance;
+            float next_ratio = project(cursor_ + 1, position, next_squared_distance);
+            if (next_squared_distance > squared_distance)
+                break;
+            cursor_++;
+            squared_distance = next_squared_distance;
+            ratio = next_ratio;
+        }
+
+        const auto &from = itinerary_[cursor_];
+        const auto &to = itinerary_[cursor_ + 1];
+        Vector2D direction = to.getPosition() - from.getPosition();
+        Vector2D offset = position - from.getPosition();
+        float length = direction.norm();
+        lateral_error_ = length > 0 ? (direction.getX() * offset.getY() - direction.getY() * offset.getX()) / length
+                                    : offset.norm();
+        float orientation = from.getOrientation()
+                            + ratio * math_utils::angleDifference(to.getOrientation(), from.getOrientation());
+        heading_error_ = math_utils::angleDifference(state.getRealOrientation(), orientation);
+        curvature_error_ = state.getRealCurvature()
+                           - (from.getCurvature() + ratio * (to.getCurvature() - from.getCurvature()));
+
+        if (cursor_ + 2 == itinerary_.size() && ratio >= 1)
+            return TrackingStatus::Finished;
+        if (replan_requested_)
+            return TrackingStatus::ReplanPending;
+        if (getPredictedDeviation() <= margin_before_collision_)
+            return TrackingStatus::OnTrack;
+        replan_requested_ = true;
+        return TrackingStatus::Replan;
+    }
+
+    std::size_t TrackingMonitor::getRejoinPoint() const
+    {
+        if (itinerary_.empty())
+            return 0;
+
+        std::size_t point = cursor_ + 1;
+        float distance = 0;
+        while (point + 1 < itinerary_.size() && distance < horizon_ && !itinerary_[point].getStop())
+        {
+            distance += itinerary_[point].getPosition().distance(itinerary_[point + 1].getPosition());
+            point++;
+        }
+        return std::min(point, itinerary_.size() - 1);
+    }
+
+    std::size_t TrackingMonitor::getCursor() const
+    {
+        return cursor_;
+    }
+
+    const std::vector<ItineraryPoint> &TrackingMonitor::getItinerary() const
+    {
+        return itinerary_;
+    }
+
+    float TrackingMonitor::getLateralError() const
+    {
+        return lateral_error_;
+    }
+
+    float TrackingMonitor::getHeadingError() const
+    {
+        return heading_error_;
+    }
+
+    float TrackingMonitor::getCurvatureError() const
+    {
+        return curvature_error_;
+    }
+
+    float TrackingMonitor::getPredictedDeviation() const
+    {
+        // The heading error opens the gap linearly, the curvature error quadratically (curvature in m^-1)
+        float heading_drift = horizon_ * std::sin(std::min(std::abs(heading_error_), static_cast<float>(M_PI) / 2));
+        float curvature_drift = std::abs(curvature_error_) * horizon_ * horizon_ * meters_per_millimeter / 2;
+        return std::abs(lateral_error_) + heading_drift + curvature_drift;
+    }
+
+    float TrackingMonitor::project(std::size_t segment, const Vector2D &point, float &squared_distance) const
+    {
+        const auto &from = itinerary_[segment].getPosition();
+        const auto &to = itinerary_[segment + 1].getPosition();
+        Vector2D direction = to - from;
+        float squared_length = direction.squaredNorm();
+        float ratio = 0;
+        if (squared_length > 0)
+        {
+            Vector2D offset = point - from;
+            ratio = (offset.getX() * direction.getX() + offset.getY() * direction.getY()) / squared_length;
+            ratio = std::min(1.f, std::max(0.f, ratio));
+        }
+        direction *= ratio;
+        squared_distance = point.squaredDistance(from + direction);
+        return ratio;
+    }
+}
@@ -0,0 +1,94 @@
+#ifndef KRAKEN_TRACKING_MONITOR_H
+#define KRAKEN_TRACKING_MONITOR_H
+
+#include <cstddef>
+#include <vector>
+
+#include "../struct/itinerary_point.h"
+#include "../struct/kinematic.h"
+
+namespace kraken
+{
+    namespace TrackingStatuses {
+        enum class TrackingStatuses {
+            OnTrack = 0,
+            Replan,             //The deviation exceeds the margin : replan from the current state to getRejoinPoint
+            ReplanPending,      //Replan was already returned for this itinerary
+            Finished
+        };
+    }
+    using TrackingStatus = TrackingStatuses::TrackingStatuses;
+
+    /*
+     * Compares the real state of the robot, as given to Kinematic::updateReal, with the followed itinerary.
+     * The real position is projected on the segment under a cursor, which only moves forward along the itinerary :
+     * an update costs O(1) amortized. The lateral, heading and curvature errors are extrapolated over a horizon,
+     * and a partial replanning is requested only when the predicted deviation exceeds MarginBeforeCollision.
+     * The monitor keeps a copy of the followed itinerary, so the caller may replace its own one at any time ; see
+     * AsynchronousPlanner::planRejoin to submit the replanning.
+     */
+    class TrackingMonitor
+    {
+    public:
+        /**
+         * @param margin_before_collision maximal predicted deviation, in mm
+         * @param horizon distance over which the heading and curvature errors are extrapolated, in mm
+         */
+        explicit TrackingMonitor(float margin_before_collision, float horizon = 200);
+
+        /**
+         * Starts following a new itinerary
+         * @param itinerary copied
+         */
+        void reset(const std::vector<ItineraryPoint> &itinerary);
+
+        /**
+         * @param state after Kinematic::updateReal
+         * @return Replan once per itinerary, when the tracking is too far off
+         */
+        TrackingStatus update(const Kinematic &state);
+
+        /**
+         * @return the itinerary point to join back, a horizon after the projection of the robot
+         */
+        std::size_t getRejoinPoint() const;
+
+        /**
+         * @return the index of the first point of the segment the robot is projected on
+         */
+        std::size_t getCursor() const;
+
+        const std::vector<ItineraryPoint> &getItinerary() const;
+
+        //Signed, positive on the left of the path, in mm
+        float getLateralError() const;
+        float getHeadingError() const;
+        float getCurvatureError() const;
+
+        /**
+         * @return the deviation extrapolated over the horizon from the three errors, in mm
+         */
+        float getPredictedDeviation() const;
+
+    private:
+        /**
+         * @param segment
+         * @param point
+         * @param squared_distance output
+         * @return the position of the projection along the segment, in [0, 1]
+         */
+        float project(std::size_t segment, const Vector2D &point, float &squared_distance) const;
+
+        const float margin_before_collision_;
+        const float horizon_;
+        std::vector<ItineraryPoint> itinerary_;
+        std::size_t cursor_;
+        bool replan_requested_;
+
+        float lateral_error_;
+        float heading_error_;
+        float curvature_error_;
+    };
+}
+
+#endif //KRAKEN_TRACKING_MONITOR_H
@@ -0,0 +1,153 @@
+#include "trajectory_resampler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "speed_profile.h"
+#include "../utils/math_utils.h"
+
+namespace kraken
+{
+    namespace
+    {
+        constexpr float meters_per_millimeter = 0.001f;
+    }
+
+    TrajectoryResampler::TrajectoryResampler(float period, float minimal_speed) :
+            period_(period), minimal_speed_(minimal_speed), start_time_(0), end_time_(0), sample_index_(0), arc_(0),
+            finished_(true)
+    {
+
+    }
+
+    void TrajectoryResampler::reset(const std::vector<ItineraryPoint> &itinerary, float start_time)
+    {
+        start_time_ = start_time;
+        sample_index_ = 0;
+        arc_ = 0;
+        finished_ = itinerary.empty();
+        if (finished_)
+            return;
+
+        speed_profile::computeArrivalTimes(itinerary, start_time, minimal_speed_, arrival_times_);
+        end_time_ = arrival_times_.back();
+
+        // A single point is a motionless arc
+        auto arc_count = std::max<std::size_t>(1, itinerary.size() - 1);
+        arcs_.assign(arc_count, Arc());
+
+        for (std::size_t i = 0; i < arc_count; i++)
+        {
+            const auto &from = itinerary[i];
+            const auto &to = itinerary[std::min(i + 1, itinerary.size() - 1)];
+            auto &arc = arcs_[i];
+            arc.start_time = arrival_times_[i];
+            arc.x0 = from.getX();
+            arc.y0 = from.getY();
+            arc.orientation0 = from.getOrientation();
+            arc.curvature0 = from.getCurvature();
+
+            float length = from.getPosition().distance(to.getPosition());
+            float duration = arrival_times_[std::min(i + 1, itinerary.size() - 1)] - arrival_times_[i];
+            if (length <= 0 || duration <= 0)
+                continue;
+
+            // Constant acceleration, unless computeArrivalTimes used the minimal speed
+            arc.inverse_length = 1 / length;
+            float mean_speed = (from.getPossibleSpeed() + to.getPossibleSpeed()) / 2;
+            if (mean_speed >= minimal_speed_)
+            {
+                arc.speed = from.getPossibleSpeed();
+                arc.acceleration = (to.getPossibleSpeed() - from.getPossibleSpeed()) / duration;
+            }
+            else
+                arc.speed = length / duration;
+
+            // Hermite tangents along the motion : backwards, the real orientation is opposite to it
+            float direction = to.getGoingForward() ? 1.f : -1.f;
+            float tangent_x0 = direction * length * std::cos(from.getOrientation());
+            float tangent_y0 = direction * length * std::sin(from.getOrientation());
+            float tangent_x1 = direction * length * std::cos(to.getOrientation());
+            float tangent_y1 = direction * length * std::sin(to.getOrientation());
+            arc.x1 = tangent_x0;
+            arc.x2 = 3 * (to.getX() - from.getX()) - 2 * tangent_x0 - tangent_x1;
+            arc.x3 = 2 * (from.getX() - to.getX()) + tangent_x0 + tangent_x1;
+            arc.y1 = tangent_y0;
+            arc.y2 = 3 * (to.getY() - from.getY()) - 2 * tangent_y0 - tangent_y1;
+            arc.y3 = 2 * (from.getY() - to.getY()) + tangent_y0 + tangent_y1;
+
+            // The quadratic term comes from the clothoid, the linear one also absorbs the discretization error so
+            // that the orientation is continuous between the arcs
+            arc.curvature1 = to.getCurvature() - from.getCurvature();
+            arc.orientation2 = direction * length * meters_per_millimeter * arc.curvature1 / 2;
+            arc.orientation1 = math_utils::angleDifference(to.getOrientation(), from.getOrientation())
+                               - arc.orientation2;
+        }
+    }
+
+    std::size_t TrajectoryResampler::generate(const SetpointBuffers &buffers)
+    {
+        if (sample_times_.size() < buffers.capacity)
+            sample_times_.resize(buffers.capacity);
+
+        // Locates the samples, the cursor only moves forward, and evaluates each run of samples on the same arc
+        std::size_t count = 0;
+        std::size_t run_begin = 0;
+        std::size_t run_arc = arc_;
+        for (; count < buffers.capacity && !finished_; count++)
+        {
+            float time = start_time_ + sample_index_++ * period_;
+            if (time >= end_time_)
+            {
+                time = end_time_;
+                finished_ = true;
+            }
+            while (arc_ + 1 < arcs_.size() && time >= arcs_[arc_ + 1].start_time)
+                arc_++;
+            if (arc_ != run_arc)
+            {
+                evaluate(arcs_[run_arc], sample_times_.data() + run_begin, count - run_begin, buffers, run_begin);
+                run_begin = count;
+                run_arc = arc_;
+            }
+            sample_times_[count] = time - arcs_[arc_].start_time;
+        }
+        if (count > run_begin)
+            evaluate(arcs_[run_arc], sample_times_.data() + run_begin, count - run_begin, buffers, run_begin);
+        return count;
+    }
+
+    void TrajectoryResampler::evaluate(const Arc &arc, const float *times, std::size_t count,
+                                       const SetpointBuffers &buffers, std::size_t offset)
+    {
+        evaluateArc(arc, times, count, buffers.x + offset, buffers.y + offset, buffers.orientation + offset,
+                    buffers.curvature + offset, buffers.speed + offset);
+    }
+
+    void TrajectoryResampler::evaluateArc(const Arc arc, const float *__restrict times, std::size_t count,
+                                          float *__restrict x, float *__restrict y, float *__restrict orientation,
+                                          float *__restrict curvature, float *__restrict speed)
+    {
+        // No branch : s doesn't need a clamp, as the times are within the arc and the speed is positive
+        for (std::size_t k = 0; k < count; k++)
+        {
+            float t = times[k];
+            float s = (arc.speed + arc.acceleration * t / 2) * t * arc.inverse_length;
+            x[k] = arc.x0 + s * (arc.x1 + s * (arc.x2 + s * arc.x3));
+            y[k] = arc.y0 + s * (arc.y1 + s * (arc.y2 + s * arc.y3));
+            orientation[k] = arc.orientation0 + s * (arc.orientation1 + s * arc.orientation2);
+            curvature[k] = arc.curvature0 + s * arc.curvature1;
+            speed[k] = arc.speed + arc.acceleration * t;
+        }
+    }
+
+    bool TrajectoryResampler::isFinished() const
+    {
+        return finished_;
+    }
+
+    float TrajectoryResampler::getNextTime() const
+    {
+        return std::min(end_time_, start_time_ + sample_index_ * period_);
+    }
+}
@@ -0,0 +1,113 @@
+#ifndef KRAKEN_TRAJECTORY_RESAMPLER_H
+#define KRAKEN_TRAJECTORY_RESAMPLER_H
+
+#include <cstddef>
+#include <vector>
+
+#include "../struct/itinerary_point.h"
+
+namespace kraken
+{
+    /*
+     * Caller-provided output of TrajectoryResampler::generate, one array per field. The arrays must not overlap.
+     * The orientations are real ones, as in ItineraryPoint, and are not normalized.
+     */
+    struct SetpointBuffers
+    {
+        float *x;
+        float *y;
+        float *orientation;
+        float *curvature;
+        //In m/s
+        float *speed;
+        std::size_t capacity;
+    };
+
+    /*
+     * Streams an itinerary as setpoints at a fixed period, e.g. 1 ms for a 1 kHz motor controller.
+     * Between two points, the speed varies linearly in time, as assumed by speed_profile::computeArrivalTimes. The
+     * path is a clothoid arc : the curvature varies linearly with the arc length, the orientation quadratically, and
+     * the position follows the cubic Hermite curve tangent to both orientations.
+     * The coefficients of the arcs are computed once per itinerary. A batch locates its samples with a cursor, then
+     * evaluates each run of samples on the same arc in a loop whose coefficients are constant : it only reads the
+     * times and writes the outputs, and GCC vectorizes it at -O3 (see tests/check_vectorization.cmake).
+     */
+    class TrajectoryResampler
+    {
+    public:
+        /**
+         * @param period in ms
+         * @param minimal_speed see speed_profile::computeArrivalTimes, in m/s
+         */
+        explicit TrajectoryResampler(float period = 1, float minimal_speed = 0.1f);
+
+        /**
+         * Starts streaming a new itinerary, e.g. after a replanning
+         * @param itinerary
+         * @param start_time the time of the first point, in ms
+         */
+        void reset(const std::vector<ItineraryPoint> &itinerary, float start_time);
+
+        /**
+         * Writes the next setpoints. The last one is the end of the itinerary, even between two periods.
+         * @param buffers
+         * @return the number of setpoints written, less than the capacity only at the end of the itinerary
+         */
+        std::size_t generate(const SetpointBuffers &buffers);
+
+        bool isFinished() const;
+
+        /**
+         * @return the time of the next setpoint, in ms
+         */
+        float getNextTime() const;
+
+    private:
+        const float period_;
+        const float minimal_speed_;
+        std::vector<float> arrival_times_;
+
+        /*
+         * The arc between the points i and i + 1, as functions of the time t since its start :
+         * s = (speed + acceleration * t / 2) * t * inverse_length, in [0, 1]
+         * x = x0 + s * (x1 + s * (x2 + s * x3)), likewise y
+         * orientation = orientation0 + s * (orientation1 + s * orientation2)
+         * curvature = curvature0 + s * curvature1
+         */
+        struct Arc
+        {
+            float start_time;
+            float speed;
+            float acceleration;
+            float inverse_length;
+            float x0, x1, x2, x3;
+            float y0, y1, y2, y3;
+            float orientation0, orientation1, orientation2;
+            float curvature0, curvature1;
+        };
+
+        static void evaluate(const Arc &arc, const float *times, std::size_t count, const SetpointBuffers &buffers,
+                             std::size_t offset);
+
+        /**
+         * The loop over the samples of an arc. The restrict parameters tell the compiler that the arrays don't
+         * overlap, so that it vectorizes the loop without run-time alias checks.
+         */
+        static void evaluateArc(const Arc arc, const float *__restrict times, std::size_t count, float *__restrict x,
+                                float *__restrict y, float *__restrict orientation, float *__restrict curvature,
+                                float *__restrict speed);
+
+        std::vector<Arc> arcs_;
+
+        //Scratch buffer of a batch : the time of each sample since the start of its arc
+        std::vector<float> sample_times_;
+
+        float start_time_;
+        float end_time_;
+        std::size_t sample_index_;
+        std::size_t arc_;
+        bool finished_;
+    };
+}
+
+#endif //KRAKEN_TRAJECTORY_RESAMPLER_H
@@ -3,22 +3,29 @@
 
 namespace kraken
 {
-    float math_utils::computeNewOrientation(const float &orientation)
+    template<typename T>
+    T math_utils::computeNewOrientation(const T &orientation)
     {
-        float computed_orientation = std::fmod(orientation, 2.f * static_cast<float>(M_PI));
+        T computed_orientation = std::fmod(orientation, 2 * static_cast<T>(M_PI));
         if (computed_orientation < 0)
-            computed_orientation += 2.f * static_cast<float>(M_PI);
+            computed_orientation += 2 * static_cast<T>(M_PI);
 
         return computed_orientation;
     }
 
-    float math_utils::angleDifference(const float &angle_1, const float &angle_2)
+    template<typename T>
+    T math_utils::angleDifference(const T &angle_1, const T &angle_2)
     {
-        float deltaO = std::fmod(angle_1 - angle_2, 2.f * static_cast<float >(M_PI));
-        if (deltaO > static_cast<float >(M_PI))
-            deltaO -= 2.f * static_cast<float>(M_PI);
-        else if (deltaO < -static_cast<float >(M_PI))
-            deltaO += 2.f * static_cast<float>(M_PI);
+        T deltaO = std::fmod(angle_1 - angle_2, 2 * static_cast<T>(M_PI));
+        if (deltaO > static_cast<T>(M_PI))
+            deltaO -= 2 * static_cast<T>(M_PI);
+        else if (deltaO < -static_cast<T>(M_PI))
+            deltaO += 2 * static_cast<T>(M_PI);
         return deltaO;
     }
-}
\ No newline at end of file
+
+    template float math_utils::computeNewOrientation(const float &orientation);
+    template double math_utils::computeNewOrientation(const double &orientation);
+    template float math_utils::angleDifference(const float &angle_1, const float &angle_2);
+    template double math_utils::angleDifference(const double &angle_1, const double &angle_2);
+}
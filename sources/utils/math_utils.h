@@ -5,8 +5,12 @@ namespace kraken
 {
     namespace math_utils
     {
-        float angleDifference(const float &angle_1, const float &angle_2);
-        float computeNewOrientation(const float &orientation);
+        //Instantiated for float and double
+        template<typename T>
+        T angleDifference(const T &angle_1, const T &angle_2);
+
+        template<typename T>
+        T computeNewOrientation(const T &orientation);
     }
 }
 
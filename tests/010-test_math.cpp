@@ -1,6 +1,9 @@
 #include "catch/catch.hpp"
 #include <cmath>
 #include "../sources/struct/vector_2d.h"
+#include "../sources/struct/fixed_point_2d.h"
+#include "../sources/struct/kinematic.h"
+#include "../sources/utils/math_utils.h"
 
 TEST_CASE("Vector2D", "[vector]")
 {
@@ -39,4 +42,54 @@ TEST_CASE("Vector2D", "[vector]")
     const kraken::Vector2D e(1, 0);
     REQUIRE (std::abs(kraken::Vector2D(0, 1).getX()
                       - e.rotate(M_PI / 2, kraken::Vector2D(0, 0)).getX()) < 0.1f);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Geometric predicates", "[vector]")
+{
+    using kraken::Vector2D;
+    using kraken::FixedPoint2D;
+
+    REQUIRE (Vector2D::segmentIntersection(Vector2D(0, 0), Vector2D(10, 10), Vector2D(0, 10), Vector2D(10, 0)));
+    REQUIRE (Vector2D::segmentIntersection(Vector2D(10, 10), Vector2D(0, 0), Vector2D(0, 10), Vector2D(10, 0)));
+    REQUIRE (!Vector2D::segmentIntersection(Vector2D(0, 0), Vector2D(4, 4), Vector2D(0, 10), Vector2D(10, 0)));
+    REQUIRE (!Vector2D::segmentIntersection(Vector2D(0, 0), Vector2D(10, 0), Vector2D(0, 1), Vector2D(10, 1)));
+    //Touching segments intersect
+    REQUIRE (Vector2D::segmentIntersection(Vector2D(0, 0), Vector2D(5, 5), Vector2D(0, 10), Vector2D(10, 0)));
+    REQUIRE (Vector2D::orientation(Vector2D(0, 0), Vector2D(1, 0), Vector2D(1, 1)) == 1);
+    REQUIRE (Vector2D::orientation(Vector2D(0, 0), Vector2D(1, 0), Vector2D(1, -1)) == -1);
+    REQUIRE (Vector2D::orientation(Vector2D(0, 0), Vector2D(1, 1), Vector2D(2, 2)) == 0);
+
+    FixedPoint2D a(Vector2D(1.5f, -2.f));
+    REQUIRE (a == FixedPoint2D(1500, -2000));
+    REQUIRE (a.toVector2D() == Vector2D(1.5f, -2.f));
+    REQUIRE (a.distanceOctile(FixedPoint2D()) == Vector2D(1.5f, -2.f).distanceOctile(Vector2D()));
+    REQUIRE (FixedPoint2D::segmentIntersection(FixedPoint2D(0, 0), FixedPoint2D(10, 10),
+                                               FixedPoint2D(0, 10), FixedPoint2D(10, 0)));
+    REQUIRE (!FixedPoint2D::segmentIntersection(FixedPoint2D(0, 0), FixedPoint2D(4, 4),
+                                                FixedPoint2D(0, 10), FixedPoint2D(10, 0)));
+    //Exact even far from the origin, where a float cross product loses the last bits
+    REQUIRE (FixedPoint2D::orientation(FixedPoint2D(3000000, 2000000), FixedPoint2D(3000001, 2000001),
+                                       FixedPoint2D(3000002, 2000002)) == 0);
+}
+
+TEST_CASE("Double precision geometry", "[vector]")
+{
+    using kraken::Vector2DT;
+
+    //A millimeter step far from the origin is lost in float, not in double
+    Vector2DT<double> a(1e8, 0);
+    a += Vector2DT<double>(1e-3, 0);
+    REQUIRE (a.getX() - 1e8 > 0);
+    REQUIRE (std::abs(Vector2DT<double>(1, 1).getFastArgument() - M_PI / 4) < 1e-3);
+    REQUIRE (kraken::Vector2D(Vector2DT<double>(1.5, -2)) == kraken::Vector2D(1.5f, -2.f));
+
+    REQUIRE (std::abs(kraken::math_utils::angleDifference(0.1, 2 * M_PI - 0.1) - 0.2) < 1e-12);
+    REQUIRE (kraken::math_utils::computeNewOrientation(-M_PI / 2) == 3 * M_PI / 2);
+
+    kraken::KinematicT<double> start(0, 0, 0.1);
+    kraken::KinematicT<double> mirrored(0, 0, -0.1);
+    REQUIRE (start.isSimilar(mirrored.Ysym(true), 1e-6, 1e-6, 1e-9));
+    kraken::ItineraryPointT<double> point(Vector2DT<double>(1, 2), -0.5, 1, true, 1, 1, false);
+    REQUIRE (point.getYsym().getY() == -2);
+    REQUIRE (std::abs(point.getOrientation() - (2 * M_PI - 0.5)) < 1e-12);
+}
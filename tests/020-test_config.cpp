@@ -71,4 +71,76 @@ TEST_CASE("Configuration", "[Configuration]")
     handler.changeModuleSection({ConfigModule::Navmesh, ConfigModule::ResearchMechanical}, "test2");
 
     handler.loadFromString("[test2]\n LongestEdgeInNavmesh=3\nEnableDebug=false");
-}
\ No newline at end of file
+}
+
+TEST_CASE("Configuration change notifications", "[Configuration]")
+{
+    using kraken::ConfigurationHandler;
+    using kraken::ConfigModule;
+    using kraken::ConfigKey;
+
+    ConfigurationHandler handler;
+    int navmesh_calls = 0;
+    int autoreplanning_calls = 0;
+    int memory_calls = 0;
+    std::vector<ConfigKey> changed;
+    handler.registerCallback(ConfigModule::Navmesh, [&navmesh_calls](ConfigurationHandler &) {
+        navmesh_calls++;
+    });
+    handler.registerChangeCallback(ConfigModule::Autoreplanning,
+                                   [&](ConfigurationHandler &, const std::vector<ConfigKey> &keys) {
+                                       autoreplanning_calls++;
+                                       changed = keys;
+                                   });
+    handler.registerCallback(ConfigModule::Memory, [&memory_calls](ConfigurationHandler &) {
+        memory_calls++;
+    });
+    int update_calls = 0;
+    std::vector<ConfigKey> updated;
+    handler.registerUpdateCallback([&](ConfigurationHandler &, const std::vector<ConfigKey> &keys) {
+        update_calls++;
+        updated = keys;
+    });
+
+    //A margin tweak only notifies its module
+    handler.loadFromString("[default]\nMarginBeforeCollision=150\nNecessaryMargin=50");
+    REQUIRE (navmesh_calls == 0);
+    REQUIRE (memory_calls == 0);
+    REQUIRE (autoreplanning_calls == 1);
+    REQUIRE (changed == std::vector<ConfigKey>{ConfigKey::NecessaryMargin, ConfigKey::MarginBeforeCollision});
+    REQUIRE (update_calls == 1);
+
+    //Same resolved values : a value equal to the default, or the same content again
+    handler.loadFromString("[default]\nMarginBeforeCollision=150\nNecessaryMargin=50\nNodeMemoryPoolSize=20000");
+    REQUIRE (autoreplanning_calls == 1);
+    REQUIRE (memory_calls == 0);
+    REQUIRE (update_calls == 1);
+
+    //A section whose values are the same as the current ones
+    handler.loadFromString("[default]\nMarginBeforeCollision=150\nNecessaryMargin=50\n"
+                           "[same]\nMarginBeforeCollision=150\nNecessaryMargin=50\n"
+                           "[other]\nMarginBeforeCollision=200\nLongestEdgeInNavmesh=300\nNodeMemoryPoolSize=100");
+    handler.changeModuleSection(ConfigModule::Autoreplanning, "same");
+    REQUIRE (autoreplanning_calls == 1);
+
+    //A burst of section changes is coalesced
+    {
+        kraken::ScopedConfigurationUpdate update(handler);
+        handler.changeModuleSection(ConfigModule::Autoreplanning, "other");
+        handler.changeModuleSection(ConfigModule::Navmesh, "other");
+        handler.changeModuleSection(ConfigModule::Memory, "other");
+        handler.changeModuleSection(ConfigModule::Autoreplanning, "default");
+        handler.changeModuleSection(ConfigModule::Autoreplanning, "other");
+        REQUIRE (navmesh_calls == 0);
+        REQUIRE (autoreplanning_calls == 1);
+    }
+    REQUIRE (navmesh_calls == 1);
+    REQUIRE (memory_calls == 1);
+    REQUIRE (autoreplanning_calls == 2);
+    REQUIRE (changed == std::vector<ConfigKey>{ConfigKey::NecessaryMargin, ConfigKey::MarginBeforeCollision});
+
+    //The update callbacks are called once, with the keys of all the modules
+    REQUIRE (update_calls == 2);
+    REQUIRE (updated == std::vector<ConfigKey>{ConfigKey::LongestEdgeInNavmesh, ConfigKey::NecessaryMargin,
+                                               ConfigKey::MarginBeforeCollision, ConfigKey::NodeMemoryPoolSize});
+}
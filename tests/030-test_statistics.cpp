@@ -0,0 +1,63 @@
+#include "catch/catch.hpp"
+#include <sstream>
+#include <thread>
+#include "../sources/instrumentation/statistics_registry.h"
+
+TEST_CASE("Latency histogram", "[statistics]")
+{
+    kraken::LatencyHistogram histogram;
+    REQUIRE (histogram.summarize().count == 0);
+
+    for (std::uint32_t i = 1; i <= 100; i++)
+        histogram.record(i * 10);
+
+    auto summary = histogram.summarize();
+    REQUIRE (summary.count == 100);
+    REQUIRE (summary.max_us == 1000);
+    // Buckets have a 12.5% relative width
+    REQUIRE (summary.p50_us >= 500);
+    REQUIRE (summary.p50_us <= 500 * 1.125);
+    REQUIRE (summary.p99_us >= 990);
+    REQUIRE (summary.p99_us <= 1000);
+
+    for (unsigned int i = 0; i < kraken::LatencyHistogram::window_count; i++)
+        histogram.rotate();
+    REQUIRE (histogram.summarize().count == 0);
+}
+
+TEST_CASE("Statistics registry", "[statistics]")
+{
+    using kraken::SearchCounter;
+    using kraken::PlanningPhase;
+
+    std::ostringstream dump_stream;
+    kraken::StatisticsRegistry registry(dump_stream, std::chrono::milliseconds(0));
+
+    auto worker = [&registry](std::uint32_t expanded) {
+        auto &statistics = kraken::search_statistics::local();
+        statistics.reset();
+        statistics.increment(SearchCounter::NodesExpanded, expanded);
+        statistics.updatePoolUsage(expanded * 2);
+        {
+            kraken::ScopedPhaseTimer timer(PlanningPhase::Search);
+        }
+        registry.publish(statistics, expanded);
+    };
+    std::thread first(worker, 10);
+    std::thread second(worker, 20);
+    first.join();
+    second.join();
+
+    auto snapshot = registry.poll();
+    REQUIRE (snapshot.search_count == 2);
+    REQUIRE (snapshot.counters[static_cast<int>(SearchCounter::NodesExpanded)] == 30);
+    REQUIRE (snapshot.pool_high_water_mark == 40);
+    REQUIRE (snapshot.search_latency.count == 2);
+    REQUIRE (snapshot.search_latency.max_us == 20);
+
+    //Nothing is dumped unless EnableDebug is set
+    REQUIRE (dump_stream.str().empty());
+    registry.setDebugEnabled(true);
+    worker(5);
+    REQUIRE (dump_stream.str().find("3 searches") != std::string::npos);
+}
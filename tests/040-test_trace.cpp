@@ -0,0 +1,90 @@
+#include "catch/catch.hpp"
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "../sources/configuration/configuration_handler.h"
+#include "../sources/instrumentation/trace_recorder.h"
+#include "../sources/planner/planner_service.h"
+
+TEST_CASE("Trace recorder", "[trace]")
+{
+    using kraken::TraceRecorder;
+    using kraken::PlanningPhase;
+
+    TraceRecorder::clear();
+    TraceRecorder::setEnabled(false);
+    {
+        kraken::ScopedTrace trace(PlanningPhase::Search);
+    }
+    std::ostringstream disabled_output;
+    TraceRecorder::writeChromeTrace(disabled_output);
+    REQUIRE (disabled_output.str().find("\"ph\":\"X\"") == std::string::npos);
+
+    //EnableDebug is true by default
+    kraken::ConfigurationHandler handler;
+    TraceRecorder::attach(handler);
+    REQUIRE (TraceRecorder::isEnabled());
+
+    handler.loadFromString("[default]\nLongestEdgeInNavmesh=3");
+    std::thread worker([] {
+        kraken::ScopedTrace trace(PlanningPhase::SpeedProfile);
+    });
+    worker.join();
+
+    std::ostringstream output;
+    TraceRecorder::writeChromeTrace(output);
+    auto json = output.str();
+    REQUIRE (json.find("{\"traceEvents\":[") == 0);
+    REQUIRE (json.find("\"name\":\"ConfigReload\"") != std::string::npos);
+    REQUIRE (json.find("\"name\":\"SpeedProfile\"") != std::string::npos);
+    REQUIRE (json.find("\"name\":\"Search\"") == std::string::npos);
+
+    handler.loadFromString("[default]\nEnableDebug=false");
+    REQUIRE (!TraceRecorder::isEnabled());
+    TraceRecorder::clear();
+
+    //A planner service attaches the recorder to its configuration
+    kraken::ConfigurationHandler service_handler;
+    std::ostringstream statistics_stream;
+    kraken::PlannerService service(service_handler, statistics_stream);
+    REQUIRE (TraceRecorder::isEnabled());
+    service_handler.loadFromString("[default]\nEnableDebug=false");
+    REQUIRE (!TraceRecorder::isEnabled());
+}
+
+TEST_CASE("Trace export during the recording", "[trace]")
+{
+    using kraken::TraceRecorder;
+    using kraken::PlanningPhase;
+
+    //The ring of the worker wraps several times while it is exported and cleared : every exported event is whole
+    TraceRecorder::clear();
+    std::atomic<bool> done(false);
+    std::thread worker([&done] {
+        for (std::int64_t i = 0; i < 20 * TraceRecorder::buffer_capacity; i++)
+            TraceRecorder::record(PlanningPhase::Search, i, i + i % 1000);
+        done.store(true);
+    });
+    do
+    {
+        std::ostringstream output;
+        TraceRecorder::writeChromeTrace(output);
+        auto json = output.str();
+        for (auto position = json.find("\"ts\":"); position != std::string::npos;
+             position = json.find("\"ts\":", position + 1))
+        {
+            auto ts = std::stoll(json.substr(position + 5));
+            auto dur = std::stoll(json.substr(json.find("\"dur\":", position) + 6));
+            REQUIRE (dur == ts % 1000);
+        }
+        TraceRecorder::clear();
+    } while (!done.load());
+    worker.join();
+
+    //The cleared events don't come back
+    TraceRecorder::clear();
+    std::ostringstream output;
+    TraceRecorder::writeChromeTrace(output);
+    REQUIRE (output.str().find("\"ph\":\"X\"") == std::string::npos);
+}
@@ -0,0 +1,122 @@
+#include "catch/catch.hpp"
+#include <cmath>
+#include <sstream>
+#include "../sources/replay/request_log.h"
+#include "../sources/replay/request_replayer.h"
+#include "../sources/planner/planner_service.h"
+
+TEST_CASE("Request log", "[replay]")
+{
+    using kraken::ConfigModule;
+    using kraken::Vector2D;
+
+    kraken::ConfigurationHandler handler;
+    handler.changeModuleSection(ConfigModule::ResearchMechanical, "test1");
+
+    kraken::PlanningRequest request;
+    request.start = kraken::Kinematic(100, 200, 0.5f, false, 0.25f, false);
+    request.goal = kraken::Kinematic(1200.5f, -300, 3.f);
+    request.obstacles.emplace_back(kraken::CircularObstacle(Vector2D(400, 50), 120.f));
+    request.obstacles.emplace_back(Vector2D(-10, 700), 80.f, Vector2D(0.5f, -0.25f), 100.f, 2500.f);
+    request.seed = 42;
+    request.captureSections(handler);
+    request.result.emplace_back(Vector2D(100, 200), 0.5f, 0.25f, false, 1.f, 0.f, false);
+    request.result.emplace_back(Vector2D(120, 210), 0.6f, 0.25f, false, 1.f, 0.5f, true);
+
+    std::stringstream log;
+    kraken::RequestLogWriter writer(log);
+    writer.write(request);
+    request.seed = 43;
+    writer.write(request);
+
+    kraken::RequestLogReader reader(log);
+    kraken::PlanningRequest read_request;
+    REQUIRE (reader.read(read_request));
+    REQUIRE (read_request.seed == 42);
+    REQUIRE (read_request.start.getPosition() == Vector2D(100, 200));
+    REQUIRE (read_request.start.getRealOrientation() == request.start.getRealOrientation());
+    REQUIRE (read_request.start.getRealCurvature() == request.start.getRealCurvature());
+    REQUIRE (!read_request.start.getGoingForward());
+    REQUIRE (read_request.goal.getPosition() == Vector2D(1200.5f, -300));
+    REQUIRE (read_request.obstacles == request.obstacles);
+    REQUIRE (read_request.obstacles[1].getVelocity() == Vector2D(0.5f, -0.25f));
+    REQUIRE (std::isinf(read_request.obstacles[0].getValidUntil()));
+    REQUIRE (read_request.sections[static_cast<int>(ConfigModule::ResearchMechanical)] == "test1");
+    REQUIRE (read_request.sections[static_cast<int>(ConfigModule::Navmesh)] == "default");
+    REQUIRE (read_request.result == request.result);
+    REQUIRE (reader.read(read_request));
+    REQUIRE (read_request.seed == 43);
+    REQUIRE (!reader.read(read_request));
+
+    std::stringstream truncated(log.str().substr(0, 20));
+    kraken::RequestLogReader truncated_reader(truncated);
+    REQUIRE_THROWS_AS (truncated_reader.read(read_request), std::invalid_argument);
+
+    //Replay: the second request is planned differently
+    handler.changeModuleSection(ConfigModule::ResearchMechanical, "default");
+    kraken::RequestReplayer replayer(handler, [&handler](const kraken::PlanningRequest &r) {
+        REQUIRE (handler.getSectionName(ConfigModule::ResearchMechanical) == "test1");
+        auto result = r.result;
+        if (r.seed == 43)
+            result.pop_back();
+        return result;
+    });
+    log.clear();
+    log.seekg(0);
+    auto report = replayer.replay(log);
+    REQUIRE (report.request_count == 2);
+    REQUIRE (report.mismatch_count == 1);
+    REQUIRE (report.requests[0].identical);
+    REQUIRE (report.requests[1].replayed_points == 1);
+}
+
+TEST_CASE("Request log of a planner service", "[replay]")
+{
+    using kraken::ConfigModule;
+    using kraken::Kinematic;
+
+    kraken::ConfigurationHandler handler;
+    handler.changeModuleSection(ConfigModule::ResearchMechanical, "test1");
+    std::ostringstream statistics;
+    kraken::PlannerService service(handler, statistics);
+    auto context = service.createContext();
+    auto obstacles = service.createObstacleSet();
+    obstacles.add(kraken::CircularObstacle(kraken::Vector2D(500, 300), 100.f));
+    std::vector<kraken::ItineraryPoint> itinerary;
+
+    //Off by default
+    std::stringstream log;
+    context->plan(Kinematic(0, 0, 0), Kinematic(1000, 0, 0), obstacles, itinerary);
+    service.setRequestLog(&log);
+    REQUIRE (context->plan(Kinematic(0, 0, 0), Kinematic(1000, 600, 0), obstacles, itinerary) ==
+             kraken::SearchStatus::Success);
+    service.setRequestLog(nullptr);
+    context->plan(Kinematic(0, 0, 0), Kinematic(1000, -600, 0), obstacles, itinerary);
+
+    kraken::RequestLogReader reader(log);
+    kraken::PlanningRequest request;
+    REQUIRE (reader.read(request));
+    REQUIRE (request.goal.getPosition() == kraken::Vector2D(1000, 600));
+    REQUIRE (request.obstacles == obstacles.getObstacles());
+    REQUIRE (request.sections[static_cast<int>(ConfigModule::ResearchMechanical)] == "test1");
+    REQUIRE (!request.result.empty());
+    REQUIRE (!reader.read(request));
+
+    //Replayed by a fresh service
+    kraken::ConfigurationHandler replay_handler;
+    kraken::PlannerService replay_service(replay_handler, statistics);
+    auto replay_context = replay_service.createContext();
+    kraken::RequestReplayer replayer(replay_handler, [&](const kraken::PlanningRequest &r) {
+        auto replay_obstacles = replay_service.createObstacleSet();
+        for (const auto &obstacle : r.obstacles)
+            replay_obstacles.add(obstacle);
+        std::vector<kraken::ItineraryPoint> replayed;
+        replay_context->plan(r.start, r.goal, replay_obstacles, replayed);
+        return replayed;
+    });
+    log.clear();
+    log.seekg(0);
+    auto report = replayer.replay(log);
+    REQUIRE (report.request_count == 1);
+    REQUIRE (report.mismatch_count == 0);
+}
@@ -0,0 +1,54 @@
+#include "catch/catch.hpp"
+#include <cmath>
+#include "../sources/configuration/configuration_handler.h"
+#include "../sources/tentacles/tentacle_library.h"
+
+TEST_CASE("Tentacle library", "[tentacles]")
+{
+    kraken::ConfigurationHandler handler;
+    kraken::TentacleLibrary library(handler);
+
+    auto max_index = library.getMaxCurvatureIndex();
+    REQUIRE (max_index == 10);
+    REQUIRE (library.getMaxIndexJump() == 1);
+    REQUIRE (library.getCurvature(max_index) == Approx(5.f));
+    REQUIRE (library.getLength() == Approx(100.f));
+    //Only the tentacles starting with a nonnegative curvature are stored
+    REQUIRE (library.getStoredTentacleCount() == 2 + 10 * 3 - 1);
+
+    //Straight line
+    auto last = library.getPointCount() - 1;
+    auto straight = library.getPoint(0, 0, last);
+    REQUIRE (straight.position.getX() == Approx(100.f));
+    REQUIRE (std::abs(straight.position.getY()) < 1e-3f);
+
+    //Circle arc of constant curvature
+    auto arc = library.getPoint(4, 4, last);
+    float radius = 1000.f / library.getCurvature(4);
+    float angle = library.getLength() / radius;
+    REQUIRE (arc.position.getX() == Approx(radius * std::sin(angle)).epsilon(1e-4));
+    REQUIRE (arc.position.getY() == Approx(radius * (1 - std::cos(angle))).epsilon(1e-4));
+    REQUIRE (arc.orientation == Approx(angle));
+
+    //The curvature reaches its target at the end of the tentacle
+    REQUIRE (library.getPoint(3, 4, last).curvature == Approx(library.getCurvature(4)));
+    REQUIRE (!library.isReachable(3, 5));
+
+    //Derived half
+    for (int from = -max_index; from <= max_index; from++)
+    {
+        for (int to = from - 1; to <= from + 1; to++)
+        {
+            if (!library.isReachable(from, to))
+                continue;
+            for (int i = 0; i <= last; i++)
+            {
+                auto point = library.getPoint(from, to, i);
+                auto mirror = library.getPoint(-from, -to, i);
+                REQUIRE (point.position == mirror.position.Ysym(true));
+                REQUIRE (point.orientation == -mirror.orientation);
+                REQUIRE (point.curvature == -mirror.curvature);
+            }
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#include "catch/catch.hpp"
+#include "../sources/obstacles/dynamic_obstacle_set.h"
+#include "../sources/trajectory/speed_profile.h"
+
+TEST_CASE("Dynamic obstacles", "[obstacles]")
+{
+    using kraken::Vector2D;
+    using kraken::ItineraryPoint;
+
+    kraken::DynamicObstacleSet obstacles(100.f, 10);
+    //Static obstacle
+    obstacles.add(kraken::CircularObstacle(Vector2D(0, 1000), 100.f));
+    //Opponent crossing the x axis at 0.5 m/s, from t = 0 to t = 4 s
+    obstacles.add(kraken::DynamicObstacle(Vector2D(1000, -500), 150.f, Vector2D(0, 0.5f), 0.f, 4000.f));
+
+    REQUIRE (obstacles.isColliding(Vector2D(0, 950), 0.f, 0.f));
+    REQUIRE (obstacles.isColliding(Vector2D(0, 950), 10000.f, 0.f));
+    REQUIRE (!obstacles.isColliding(Vector2D(0, 850), 500.f, 0.f));
+    REQUIRE (obstacles.isColliding(Vector2D(0, 850), 500.f, 100.f));
+
+    REQUIRE (obstacles.isColliding(Vector2D(1000, 0), 1000.f, 0.f));
+    REQUIRE (!obstacles.isColliding(Vector2D(1000, 0), 100.f, 0.f));
+    //Beyond the horizon of the broadphase
+    REQUIRE (obstacles.isColliding(Vector2D(1000, 1000), 3000.f, 0.f));
+    REQUIRE (!obstacles.isColliding(Vector2D(1000, 1000), 5000.f, 0.f));
+
+    //An itinerary along the x axis at 1 m/s reaches x = 900 at t = 0.9 s, 112 mm away from the opponent
+    std::vector<ItineraryPoint> itinerary;
+    for (int i = 0; i <= 20; i++)
+        itinerary.emplace_back(Vector2D(i * 100.f, 0), 0.f, 0.f, true, 1.f, 1.f, false);
+    std::vector<float> arrival_times;
+    kraken::speed_profile::computeArrivalTimes(itinerary, 0.f, 0.1f, arrival_times);
+    REQUIRE (arrival_times.size() == itinerary.size());
+    REQUIRE (arrival_times[9] == Approx(900.f));
+    REQUIRE (obstacles.findFirstCollision(itinerary, arrival_times, 0.f) == 9);
+
+    //Leaving 2 s later, the robot passes after the opponent
+    kraken::speed_profile::computeArrivalTimes(itinerary, 2000.f, 0.1f, arrival_times);
+    REQUIRE (obstacles.findFirstCollision(itinerary, arrival_times, 0.f) == -1);
+}
+
+TEST_CASE("Dynamic obstacle capacity", "[obstacles]")
+{
+    using kraken::Vector2D;
+
+    kraken::DynamicObstacleSet obstacles(100.f, 10, 2);
+    REQUIRE (obstacles.add(kraken::CircularObstacle(Vector2D(0, 0), 100.f)));
+    REQUIRE (obstacles.add(kraken::DynamicObstacle(Vector2D(1000, 0), 100.f, Vector2D(0, 1), 0.f, 500.f)));
+    REQUIRE (!obstacles.add(kraken::CircularObstacle(Vector2D(2000, 0), 100.f)));
+    REQUIRE (obstacles.getObstacles().size() == 2);
+    REQUIRE (obstacles.getRejectedCount() == 1);
+    REQUIRE (!obstacles.isColliding(Vector2D(2000, 0), 0.f, 0.f));
+
+    obstacles.clear();
+    REQUIRE (obstacles.getRejectedCount() == 0);
+    REQUIRE (obstacles.add(kraken::CircularObstacle(Vector2D(2000, 0), 100.f)));
+    REQUIRE (obstacles.isColliding(Vector2D(2000, 0), 0.f, 0.f));
+}
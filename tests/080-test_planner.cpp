@@ -0,0 +1,307 @@
+#include "catch/catch.hpp"
+#include <sstream>
+#include <thread>
+#include "../sources/configuration/configuration_handler.h"
+#include "../sources/planner/closed_set.h"
+#include "../sources/planner/planner_service.h"
+#include "../sources/planner/planning_context_impl.h"
+
+TEST_CASE("Planner service", "[planner]")
+{
+    using kraken::Vector2D;
+    using kraken::SearchStatus;
+
+    kraken::ConfigurationHandler handler;
+    handler.loadFromString("[default]\nEnableDebug=false");
+    std::ostringstream statistics_stream;
+    kraken::PlannerService service(handler, statistics_stream);
+
+    auto context = service.createContext();
+    kraken::DynamicObstacleSet obstacles;
+    std::vector<kraken::ItineraryPoint> itinerary;
+
+    kraken::Kinematic start(0, 0, 0);
+    kraken::Kinematic goal(1000, 400, 0);
+    REQUIRE (context->plan(start, goal, obstacles, itinerary) == SearchStatus::Success);
+    REQUIRE (itinerary.front().getPosition() == start.getPosition());
+    REQUIRE (itinerary.back().getPosition().distance(goal.getPosition()) < 100);
+    REQUIRE (itinerary.back().getStop());
+    REQUIRE (itinerary.back().getPossibleSpeed() == 0);
+    for (std::size_t i = 1; i < itinerary.size(); i++)
+    {
+        REQUIRE (itinerary[i].getPosition().distance(itinerary[i - 1].getPosition()) < 25);
+        REQUIRE (itinerary[i].getPossibleSpeed() <= itinerary[i].getMaxSpeed());
+    }
+
+    //An obstacle on the straight line
+    obstacles.add(kraken::CircularObstacle(Vector2D(500, 200), 150));
+    REQUIRE (context->plan(start, goal, obstacles, itinerary) == SearchStatus::Success);
+    for (const auto &point : itinerary)
+        REQUIRE (!obstacles.getObstacles()[0].isColliding(point.getPosition()));
+
+    //Same request again, served by the cache
+    REQUIRE (context->plan(start, goal, obstacles, itinerary) == SearchStatus::Success);
+
+    //The goal is enclosed : the search exhausts the open space around the start, and returns the best partial path
+    kraken::DynamicObstacleSet wall;
+    wall.add(kraken::CircularObstacle(goal.getPosition(), 400));
+    REQUIRE (context->plan(start, goal, wall, itinerary) == SearchStatus::PoolExhausted);
+    REQUIRE (!itinerary.empty());
+    REQUIRE (itinerary.back().getPosition().distance(goal.getPosition())
+             < start.getPosition().distance(goal.getPosition()));
+    for (const auto &point : itinerary)
+        REQUIRE (!wall.getObstacles()[0].isColliding(point.getPosition()));
+
+    auto snapshot = service.getStatistics().poll();
+    REQUIRE (snapshot.search_count == 4);
+    REQUIRE (snapshot.counters[static_cast<int>(kraken::SearchCounter::CacheHits)] == 1);
+    REQUIRE (snapshot.counters[static_cast<int>(kraken::SearchCounter::NodesExpanded)] > 0);
+    REQUIRE (snapshot.counters[static_cast<int>(kraken::SearchCounter::NodesPruned)] > 0);
+    REQUIRE (snapshot.pool_high_water_mark == service.getSnapshot()->parameters.node_memory_pool_size);
+    REQUIRE (snapshot.obstacle_high_water_mark == 1);
+
+    //Contexts planning concurrently share the same tables
+    auto other_context = service.createContext();
+    SearchStatus statuses[2];
+    std::vector<kraken::ItineraryPoint> itineraries[2];
+    std::thread first([&] { statuses[0] = context->plan(start, goal, obstacles, itineraries[0]); });
+    std::thread second([&] { statuses[1] = other_context->plan(start, goal, obstacles, itineraries[1]); });
+    first.join();
+    second.join();
+    REQUIRE (statuses[0] == SearchStatus::Success);
+    REQUIRE (statuses[1] == SearchStatus::Success);
+    REQUIRE (itineraries[0] == itineraries[1]);
+
+    //Changing a margin keeps the tentacles, changing the pool size is applied at the next request
+    auto tentacles = service.getSnapshot()->tentacles;
+    handler.loadFromString("[default]\nEnableDebug=false\nNecessaryMargin=50\nNodeMemoryPoolSize=3");
+    REQUIRE (service.getSnapshot()->tentacles == tentacles);
+    REQUIRE (context->plan(start, goal, obstacles, itinerary) == SearchStatus::PoolExhausted);
+    REQUIRE (context->getNodePool().getCapacity() == 3);
+
+    //A navmesh setting doesn't change what the planner uses
+    auto snapshot_before = service.getSnapshot();
+    handler.loadFromString("[default]\nEnableDebug=false\nNecessaryMargin=50\nNodeMemoryPoolSize=3\n"
+                           "LongestEdgeInNavmesh=300");
+    REQUIRE (service.getSnapshot() == snapshot_before);
+
+    //Negative pool sizes are read as empty pools
+    handler.loadFromString("[default]\nEnableDebug=false\nNodeMemoryPoolSize=-5\nObstaclesMemoryPoolSize=-1");
+    REQUIRE (service.getSnapshot()->parameters.node_memory_pool_size == 0);
+    REQUIRE (service.createObstacleSet().getCapacity() == 0);
+    REQUIRE (context->plan(start, goal, obstacles, itinerary) == SearchStatus::PoolExhausted);
+    REQUIRE (context->getNodePool().getCapacity() == 0);
+}
+
+TEST_CASE("Plan cache", "[planner]")
+{
+    using kraken::Vector2D;
+    using kraken::Kinematic;
+
+    kraken::PlanCache cache(2);
+    kraken::DynamicObstacleSet obstacles;
+    std::vector<kraken::ItineraryPoint> itinerary;
+    std::vector<kraken::ItineraryPoint> cached;
+    for (int i = 0; i <= 10; i++)
+        itinerary.emplace_back(Vector2D(i * 100.f, 300), 0.f, 0.f, true, 1.f, 1.f, i == 10);
+
+    Kinematic start(0, 300, 0);
+    Kinematic goal(1000, 300, 0);
+    REQUIRE (!cache.find(start, goal, obstacles, 0, 0.1f, cached));
+    cache.insert(start, goal, itinerary);
+
+    //Similar states
+    REQUIRE (cache.find(Kinematic(2, 301, 0.01f), Kinematic(1001, 299, 0), obstacles, 0, 0.1f, cached));
+    REQUIRE (cached == itinerary);
+    REQUIRE (!cache.find(Kinematic(0, 300, 0.5f), goal, obstacles, 0, 0.1f, cached));
+    REQUIRE (!cache.find(start, Kinematic(1100, 300, 0), obstacles, 0, 0.1f, cached));
+
+    //The other team colour
+    REQUIRE (cache.find(Kinematic(0, -300, 0), Kinematic(1000, -300, 0), obstacles, 0, 0.1f, cached));
+    REQUIRE (cached.back().getPosition() == Vector2D(1000, -300));
+
+    //A new obstacle invalidates the entry
+    obstacles.add(kraken::CircularObstacle(Vector2D(500, 300), 50));
+    REQUIRE (!cache.find(start, goal, obstacles, 0, 0.1f, cached));
+    REQUIRE (cache.size() == 0);
+
+    //Least recently used entry evicted
+    cache.insert(start, goal, itinerary);
+    cache.insert(Kinematic(0, 500, 0), goal, itinerary);
+    REQUIRE (cache.find(start, goal, kraken::DynamicObstacleSet(), 0, 0.1f, cached));
+    cache.insert(Kinematic(0, 700, 0), goal, itinerary);
+    REQUIRE (cache.size() == 2);
+    REQUIRE (cache.find(start, goal, kraken::DynamicObstacleSet(), 0, 0.1f, cached));
+    REQUIRE (!cache.find(Kinematic(0, 500, 0), goal, kraken::DynamicObstacleSet(), 0, 0.1f, cached));
+}
+
+namespace
+{
+    //The default configuration, without backward motion
+    struct FixedRobot
+    {
+        static constexpr float max_curvature = 5;
+        static constexpr float max_curvature_derivative = 5;
+        static constexpr float max_lateral_acceleration = 3;
+        static constexpr float max_linear_acceleration = 2;
+        static constexpr float max_speed = 1;
+        static constexpr float footprint_radius = 0;
+        static constexpr bool allow_backward_motion = false;
+        static constexpr float precision_trace = 0.02f;
+        static constexpr int nb_points = 5;
+    };
+}
+
+TEST_CASE("Static robot model", "[planner]")
+{
+    using Model = kraken::StaticRobotModel<FixedRobot>;
+    static_assert(Model::getMaxCurvatureIndex() == 10, "folded at compile time");
+    static_assert(!Model::allowBackwardMotion(), "folded at compile time");
+    REQUIRE (Model::getTentacles().getMaxCurvatureIndex() == Model::getMaxCurvatureIndex());
+    REQUIRE (Model::getTentacles().getMaxIndexJump() == Model::getMaxIndexJump());
+    REQUIRE (Model::getTentacles().getLength() == Model::getTentacleLength());
+
+    //Same itinerary as the runtime model with the same configuration
+    kraken::ConfigurationHandler handler;
+    handler.loadFromString("[default]\nEnableDebug=false\nAllowBackwardMotion=false\nPlanCacheSize=0");
+    std::ostringstream statistics_stream;
+    kraken::PlannerService service(handler, statistics_stream);
+    kraken::PlanningContext runtime_context(service);
+    kraken::BasicPlanningContext<Model> static_context(service);
+
+    kraken::DynamicObstacleSet obstacles;
+    obstacles.add(kraken::CircularObstacle(kraken::Vector2D(500, 200), 150));
+    kraken::Kinematic start(0, 0, 0);
+    kraken::Kinematic goal(1000, 400, 0);
+    std::vector<kraken::ItineraryPoint> runtime_itinerary;
+    std::vector<kraken::ItineraryPoint> static_itinerary;
+    REQUIRE (runtime_context.plan(start, goal, obstacles, runtime_itinerary) == kraken::SearchStatus::Success);
+    REQUIRE (static_context.plan(start, goal, obstacles, static_itinerary) == kraken::SearchStatus::Success);
+    REQUIRE (static_itinerary == runtime_itinerary);
+    for (const auto &point : static_itinerary)
+        REQUIRE (point.getGoingForward());
+}
+
+TEST_CASE("Planner with a navmesh", "[planner]")
+{
+    using kraken::Vector2D;
+    using kraken::SearchStatus;
+
+    kraken::ConfigurationHandler handler;
+    handler.loadFromString("[default]\nEnableDebug=false\nPlanCacheSize=0");
+    std::ostringstream statistics_stream;
+    kraken::PlannerService service(handler, statistics_stream);
+    auto context = service.createContext();
+
+    auto navmesh = std::make_shared<kraken::Navmesh>(Vector2D(-1500, 0), Vector2D(1500, 2000));
+    kraken::CircularObstacle fixed_obstacle(Vector2D(0, 1000), 200);
+    navmesh->addPolygon(kraken::Navmesh::getPolygon(fixed_obstacle));
+    service.setNavmesh(navmesh);
+
+    kraken::DynamicObstacleSet obstacles;
+    std::vector<kraken::ItineraryPoint> itinerary;
+    kraken::Kinematic start(-600, 1000, 0);
+    kraken::Kinematic goal(600, 1000, 0);
+    REQUIRE (context->plan(start, goal, obstacles, itinerary) == SearchStatus::Success);
+    for (const auto &point : itinerary)
+        REQUIRE (!fixed_obstacle.isColliding(point.getPosition()));
+    for (const auto &point : itinerary)
+        REQUIRE (navmesh->locate(point.getPosition()) != -1);
+
+    //Unreachable in the navmesh : fails before the search
+    REQUIRE (context->plan(start, kraken::Kinematic(0, 1000, 0), obstacles, itinerary) == SearchStatus::NoPath);
+    REQUIRE (context->getNodePool().getUsed() == 0);
+
+    //The navmesh is kept when the configuration changes
+    handler.loadFromString("[default]\nEnableDebug=false\nPlanCacheSize=0\nNecessaryMargin=10");
+    REQUIRE (service.getSnapshot()->navmesh == navmesh);
+
+    //The straight line cuts the corner of an added square : the path goes around it
+    int square = service.addFixedObstacle({Vector2D(-100, 200), Vector2D(100, 200), Vector2D(100, 400),
+                                           Vector2D(-100, 400)});
+    auto is_in_square = [](const Vector2D &point) {
+        return point.getX() > -100 && point.getX() < 100 && point.getY() > 200 && point.getY() < 400;
+    };
+    kraken::Kinematic corner_start(-300, 250, 0.46f);
+    kraken::Kinematic corner_goal(300, 550, 0.46f);
+    kraken::NavmeshQuery query;
+    std::vector<Vector2D> path;
+    REQUIRE (query.findPath(*service.getSnapshot()->navmesh, corner_start.getPosition(), corner_goal.getPosition(),
+                            path));
+    REQUIRE (path.size() == 3);
+    REQUIRE (path[1] == Vector2D(-100, 400));
+    REQUIRE (context->plan(corner_start, corner_goal, obstacles, itinerary) == SearchStatus::Success);
+    for (const auto &point : itinerary)
+        REQUIRE (!is_in_square(point.getPosition()));
+
+    //Unknown identifiers are ignored
+    auto navmesh_before = service.getSnapshot()->navmesh;
+    REQUIRE (!service.removeFixedObstacle(square + 1));
+    REQUIRE (!service.removeFixedObstacle(-1));
+    REQUIRE (service.getSnapshot()->navmesh == navmesh_before);
+
+    //The updates of the fixed obstacles are timed as navmesh loads
+    REQUIRE (service.removeFixedObstacle(square));
+    REQUIRE (!service.removeFixedObstacle(square));
+    auto snapshot = service.getStatistics().poll();
+    REQUIRE (snapshot.phase_latency[static_cast<int>(kraken::PlanningPhase::NavmeshLoad)].count == 2);
+}
+
+TEST_CASE("Node pool exhaustion", "[planner]")
+{
+    using kraken::Vector2D;
+    using kraken::SearchStatus;
+    using kraken::SearchCounter;
+
+    kraken::ConfigurationHandler handler;
+    handler.loadFromString("[default]\nEnableDebug=false\nPlanCacheSize=0\nNodeMemoryPoolSize=60");
+    std::ostringstream statistics_stream;
+    kraken::PlannerService service(handler, statistics_stream);
+    auto context = service.createContext();
+    std::vector<kraken::ItineraryPoint> itinerary;
+    kraken::Kinematic start(0, 0, 0);
+    kraken::Kinematic goal(1000, 400, 0);
+
+    //Too small for a plain A* : the worst open nodes are pruned and the search still succeeds
+    auto obstacles = service.createObstacleSet();
+    REQUIRE (obstacles.getCapacity() == 50000);
+    REQUIRE (context->plan(start, goal, obstacles, itinerary) == SearchStatus::Success);
+    const auto &statistics = kraken::search_statistics::local();
+    REQUIRE (statistics.get(SearchCounter::NodesPruned) > 0);
+    REQUIRE (statistics.pool_high_water_mark == 60);
+    REQUIRE (itinerary.back().getPosition().distance(goal.getPosition()) < 100);
+}
+
+TEST_CASE("Closed set", "[planner]")
+{
+    kraken::ClosedSet closed(100);
+    REQUIRE (closed.getCapacity() == 512);
+    float cost;
+    REQUIRE (!closed.find(42, cost));
+    REQUIRE (closed.insert(42, 3.f));
+    REQUIRE (closed.insert(42, 2.f));
+    REQUIRE (closed.find(42, cost));
+    REQUIRE (cost == 2.f);
+    REQUIRE (closed.getSize() == 1);
+
+    //Cleared by generation
+    closed.clear();
+    REQUIRE (!closed.find(42, cost));
+    REQUIRE (closed.getSize() == 0);
+
+    //Keys differing only in their high bits, up to three quarters of the table
+    for (std::uint64_t i = 0; i < 384; i++)
+        REQUIRE (closed.insert(i << 48, static_cast<float>(i)));
+    REQUIRE (!closed.insert(1, 0.f));
+    REQUIRE (closed.insert(5ULL << 48, 0.f));
+    for (std::uint64_t i = 0; i < 384; i++)
+    {
+        REQUIRE (closed.find(i << 48, cost));
+        REQUIRE (cost == (i == 5 ? 0.f : static_cast<float>(i)));
+    }
+    REQUIRE (!closed.find(1, cost));
+
+    closed.resize(1000);
+    REQUIRE (closed.getCapacity() == 4096);
+    REQUIRE (!closed.find(0, cost));
+}
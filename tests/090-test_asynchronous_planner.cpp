@@ -0,0 +1,151 @@
+#include "catch/catch.hpp"
+#include <cmath>
+#include <sstream>
+#include "../sources/configuration/configuration_handler.h"
+#include "../sources/planner/asynchronous_planner.h"
+#include "../sources/planner/goal_evaluator.h"
+#include "../sources/planner/planner_service.h"
+#include "../sources/trajectory/tracking_monitor.h"
+
+TEST_CASE("Asynchronous planner", "[planner]")
+{
+    using kraken::Vector2D;
+    using kraken::SearchStatus;
+    using kraken::PlanPriority;
+
+    //A single worker, and a pool large enough for a long background search
+    kraken::ConfigurationHandler handler;
+    handler.loadFromString("[default]\nEnableDebug=false\nThreadNumber=1\nNodeMemoryPoolSize=2000000");
+    std::ostringstream statistics_stream;
+    kraken::PlannerService service(handler, statistics_stream);
+    kraken::AsynchronousPlanner planner(service);
+
+    kraken::Kinematic start(0, 0, 0);
+    kraken::Kinematic goal(1000, 400, 0);
+    kraken::DynamicObstacleSet obstacles;
+    kraken::DynamicObstacleSet enclosed_goal;
+    enclosed_goal.add(kraken::CircularObstacle(goal.getPosition(), 400));
+
+    auto handle = planner.planAsync(start, goal, obstacles);
+    REQUIRE (handle.getStatus() == SearchStatus::Success);
+    REQUIRE (!handle.getItinerary().empty());
+
+    //A default handle refers to no request, cancelling it does nothing
+    kraken::PlanHandle empty_handle;
+    REQUIRE (!empty_handle.isValid());
+    empty_handle.cancel();
+    REQUIRE (handle.isValid());
+
+    //A background query that can't succeed is preempted by an urgent one
+    auto background = planner.planAsync(start, goal, enclosed_goal, PlanPriority::Background);
+    auto pending = planner.planAsync(start, goal, enclosed_goal, PlanPriority::Background);
+    auto urgent = planner.planAsync(start, goal, obstacles, PlanPriority::Urgent);
+    REQUIRE (urgent.getStatus() == SearchStatus::Success);
+    REQUIRE (!background.isReady());
+
+    //Cancellation of a pending then of a running request
+    pending.cancel();
+    REQUIRE (pending.isReady());
+    REQUIRE (pending.getStatus() == SearchStatus::Cancelled);
+    background.cancel();
+    REQUIRE (background.waitFor(std::chrono::milliseconds(5000)));
+    REQUIRE (background.getStatus() == SearchStatus::Cancelled);
+
+    //The destruction of the planner cancels the remaining requests
+    auto remaining = planner.planAsync(start, goal, enclosed_goal, PlanPriority::Background);
+    remaining.cancel();
+    REQUIRE (remaining.getStatus() == SearchStatus::Cancelled);
+}
+
+TEST_CASE("Rejoin of a tracked itinerary", "[planner]")
+{
+    using kraken::Vector2D;
+    using kraken::ItineraryPoint;
+    using kraken::TrackingStatus;
+    using kraken::SearchStatus;
+
+    kraken::ConfigurationHandler handler;
+    handler.loadFromString("[default]\nEnableDebug=false\nThreadNumber=1");
+    std::ostringstream statistics_stream;
+    kraken::PlannerService service(handler, statistics_stream);
+    kraken::AsynchronousPlanner planner(service);
+    kraken::DynamicObstacleSet obstacles;
+
+    kraken::TrackingMonitor monitor(100, 200);
+    REQUIRE_THROWS_AS (planner.planRejoin(kraken::Kinematic(0, 0, 0), monitor, obstacles), std::invalid_argument);
+
+    //The monitor keeps its own copy of the straight line along x
+    {
+        std::vector<ItineraryPoint> itinerary;
+        for (int i = 0; i <= 100; i++)
+            itinerary.emplace_back(Vector2D(20.f * i, 0), 0, 0, true, 1, 1, i == 100);
+        monitor.reset(itinerary);
+    }
+
+    //Drifting to the left until a replanning is requested
+    kraken::Kinematic state;
+    float y = 0;
+    TrackingStatus status = TrackingStatus::OnTrack;
+    for (int i = 0; i < 300 && status == TrackingStatus::OnTrack; i++)
+    {
+        y += 2 * std::sin(0.2f);
+        state.updateReal(300 + 2.f * i, y, 0.2f, 0);
+        status = monitor.update(state);
+    }
+    REQUIRE (status == TrackingStatus::Replan);
+
+    const auto &rejoin = monitor.getItinerary()[monitor.getRejoinPoint()];
+    auto handle = planner.planRejoin(state, monitor, obstacles);
+    REQUIRE (handle.getStatus() == SearchStatus::Success);
+    const auto &itinerary = handle.getItinerary();
+    REQUIRE (!itinerary.empty());
+    REQUIRE (itinerary.front().getPosition().distance(state.getPosition()) < 1);
+    REQUIRE (itinerary.back().getPosition().distance(rejoin.getPosition()) < 100);
+}
+
+TEST_CASE("Goal evaluator", "[planner]")
+{
+    using kraken::Vector2D;
+    using kraken::Kinematic;
+    using kraken::SearchStatus;
+
+    kraken::ConfigurationHandler handler;
+    handler.loadFromString("[default]\nEnableDebug=false\nThreadNumber=2");
+    std::ostringstream statistics_stream;
+    kraken::PlannerService service(handler, statistics_stream);
+    auto navmesh = std::make_shared<kraken::Navmesh>(Vector2D(-1500, 0), Vector2D(1500, 2000));
+    kraken::CircularObstacle fixed_obstacle(Vector2D(0, 1000), 300);
+    navmesh->addPolygon(kraken::Navmesh::getPolygon(fixed_obstacle));
+    service.setNavmesh(navmesh);
+
+    kraken::GoalEvaluator evaluator(service);
+    Kinematic start(-1000, 1000, 0);
+    std::vector<Kinematic> goals = {Kinematic(1000, 1000, 0), Kinematic(-500, 1000, 0), Kinematic(0, 1000, 0),
+                                    Kinematic(-1000, 1600, 0)};
+    std::vector<kraken::GoalEstimate> estimates;
+    evaluator.estimate(start, goals, estimates);
+    REQUIRE (estimates.size() == goals.size());
+    //At 1 m/s, i.e. 1 mm/ms, around the fixed obstacle
+    REQUIRE (estimates[0].travel_time > 2000);
+    REQUIRE (estimates[1].travel_time == Approx(500));
+    REQUIRE (std::isinf(estimates[2].travel_time));
+    REQUIRE (estimates[3].travel_time == Approx(600));
+    for (const auto &estimate : estimates)
+        REQUIRE (!estimate.refined);
+
+    //The two closest goals are planned : the travel times include the turns and the accelerations
+    kraken::AsynchronousPlanner planner(service);
+    kraken::DynamicObstacleSet obstacles;
+    auto lower_bounds = estimates;
+    evaluator.refine(planner, start, goals, obstacles, 2, estimates);
+    REQUIRE (!estimates[0].refined);
+    REQUIRE (estimates[0].travel_time == lower_bounds[0].travel_time);
+    REQUIRE (estimates[1].refined);
+    REQUIRE (estimates[1].status == SearchStatus::Success);
+    REQUIRE (estimates[1].travel_time > 0);
+    REQUIRE (!std::isinf(estimates[1].travel_time));
+    REQUIRE (estimates[3].refined);
+    REQUIRE (estimates[3].status == SearchStatus::Success);
+    REQUIRE (estimates[3].travel_time > lower_bounds[3].travel_time);
+    REQUIRE (!estimates[2].refined);
+}
@@ -0,0 +1,311 @@
+#include "catch/catch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include "../sources/navmesh/navmesh.h"
+#include "../sources/navmesh/navmesh_query.h"
+#include "../sources/navmesh/polygon_file.h"
+
+namespace
+{
+    int locateByScan(const kraken::Navmesh &navmesh, const kraken::Vector2D &point)
+    {
+        for (int triangle = 0; triangle < static_cast<int>(navmesh.getTriangleCount()); triangle++)
+            if (navmesh.getTriangle(triangle).alive && navmesh.contains(triangle, point))
+                return triangle;
+        return -1;
+    }
+
+    //Counterclockwise triangles with symmetric adjacency
+    void checkTriangulation(const kraken::Navmesh &navmesh)
+    {
+        using kraken::Vector2D;
+        for (int triangle = 0; triangle < static_cast<int>(navmesh.getTriangleCount()); triangle++)
+        {
+            const auto &current = navmesh.getTriangle(triangle);
+            if (!current.alive)
+                continue;
+            for (int i = 0; i < 3; i++)
+            {
+                const auto &from = navmesh.getVertex(current.vertices[i]);
+                const auto &to = navmesh.getVertex(current.vertices[(i + 1) % 3]);
+                REQUIRE (Vector2D::orientation(from, to, navmesh.getVertex(current.vertices[(i + 2) % 3])) == 1);
+
+                int neighbour = current.neighbours[i];
+                if (neighbour == -1)
+                    continue;
+                REQUIRE (navmesh.getTriangle(neighbour).alive);
+                bool linked = false;
+                for (int j = 0; j < 3; j++)
+                {
+                    if (navmesh.getTriangle(neighbour).neighbours[j] != triangle)
+                        continue;
+                    linked = true;
+                    REQUIRE (navmesh.getTriangle(neighbour).constrained[j] == current.constrained[i]);
+                }
+                REQUIRE (linked);
+            }
+        }
+    }
+
+    //Every edge of the outline is covered by constrained edges of the triangulation
+    void checkOutline(const kraken::Navmesh &navmesh, const std::vector<kraken::Vector2D> &polygon)
+    {
+        using kraken::Vector2D;
+        auto is_on_edge = [](const Vector2D &from, const Vector2D &to, const Vector2D &point) {
+            Vector2D direction = to - from;
+            Vector2D offset = point - from;
+            float length = direction.norm();
+            float along = offset.dot(direction) / length;
+            return std::abs(direction.getX() * offset.getY() - direction.getY() * offset.getX()) / length < 0.01f
+                   && along > -0.01f && along < length + 0.01f;
+        };
+
+        for (std::size_t k = 0; k < polygon.size(); k++)
+        {
+            const auto &from = polygon[k];
+            const auto &to = polygon[(k + 1) % polygon.size()];
+            float covered = 0;
+            for (int triangle = 0; triangle < static_cast<int>(navmesh.getTriangleCount()); triangle++)
+            {
+                const auto &current = navmesh.getTriangle(triangle);
+                if (!current.alive)
+                    continue;
+                for (int i = 0; i < 3; i++)
+                {
+                    int a = current.vertices[i];
+                    int b = current.vertices[(i + 1) % 3];
+                    const auto &p = navmesh.getVertex(a);
+                    const auto &q = navmesh.getVertex(b);
+                    //Each inner edge is seen from its two triangles
+                    if (a > b || !is_on_edge(from, to, p) || !is_on_edge(from, to, q))
+                        continue;
+                    REQUIRE (current.constrained[i]);
+                    covered += p.distance(q);
+                }
+            }
+            REQUIRE (covered == Approx(from.distance(to)));
+        }
+    }
+}
+
+TEST_CASE("Navmesh", "[navmesh]")
+{
+    using kraken::Vector2D;
+
+    kraken::Navmesh navmesh(Vector2D(-1500, 0), Vector2D(1500, 2000));
+    REQUIRE (navmesh.locate(Vector2D(0, 1000)) != -1);
+    REQUIRE (navmesh.locate(Vector2D(-1600, 1000)) == -1);
+
+    kraken::CircularObstacle obstacle(Vector2D(0, 1000), 200);
+    navmesh.addPolygon(kraken::Navmesh::getPolygon(obstacle));
+    navmesh.addPolygon(kraken::Navmesh::getPolygon(kraken::CircularObstacle(Vector2D(-800, 500), 150), 12));
+    navmesh.addPolygon({Vector2D(700, 1500), Vector2D(1100, 1500), Vector2D(1100, 1900), Vector2D(700, 1900)});
+    //Partially outside the table
+    navmesh.addPolygon(kraken::Navmesh::getPolygon(kraken::CircularObstacle(Vector2D(1500, 200), 150)));
+
+    checkTriangulation(navmesh);
+    checkOutline(navmesh, kraken::Navmesh::getPolygon(obstacle));
+    checkOutline(navmesh, {Vector2D(700, 1500), Vector2D(1100, 1500), Vector2D(1100, 1900), Vector2D(700, 1900)});
+
+    //An edge which is not Delaunay, because of the vertices of a polygon just above it
+    navmesh.addPolygon({Vector2D(-540, 1503), Vector2D(-460, 1503), Vector2D(-500, 1550)});
+    std::vector<kraken::Vector2D> square = {Vector2D(-550, 1400), Vector2D(-450, 1400), Vector2D(-450, 1500),
+                                            Vector2D(-550, 1500)};
+    navmesh.addPolygon(square);
+    checkTriangulation(navmesh);
+    checkOutline(navmesh, square);
+    REQUIRE (navmesh.getTriangle(navmesh.locate(Vector2D(-500, 1499))).blocked);
+    REQUIRE (!navmesh.getTriangle(navmesh.locate(Vector2D(-500, 1501.5f))).blocked);
+
+    REQUIRE (navmesh.getTriangle(navmesh.locate(obstacle.getPosition())).blocked);
+    REQUIRE (navmesh.getTriangle(navmesh.locate(Vector2D(900, 1700))).blocked);
+    REQUIRE (!navmesh.getTriangle(navmesh.locate(Vector2D(0, 1300))).blocked);
+
+    //Same result as a scan, from the grid or warm-started along a path
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> x(-1500, 1500);
+    std::uniform_real_distribution<float> y(0, 2000);
+    for (int i = 0; i < 500; i++)
+    {
+        Vector2D point(x(generator), y(generator));
+        int expected = locateByScan(navmesh, point);
+        int triangle = navmesh.locate(point);
+        REQUIRE (navmesh.contains(triangle, point));
+        REQUIRE (navmesh.getTriangle(triangle).blocked == navmesh.getTriangle(expected).blocked);
+    }
+    int hint = -1;
+    for (int i = 0; i <= 100; i++)
+    {
+        Vector2D point(-1400 + 28.f * i, 100 + 18.f * i);
+        hint = navmesh.locate(point, hint);
+        REQUIRE (hint != -1);
+        REQUIRE (navmesh.contains(hint, point));
+    }
+}
+
+TEST_CASE("Navmesh query", "[navmesh]")
+{
+    using kraken::Vector2D;
+    using kraken::NavmeshQuery;
+
+    kraken::Navmesh navmesh(Vector2D(-1500, 0), Vector2D(1500, 2000));
+    kraken::CircularObstacle obstacle(Vector2D(0, 1000), 300);
+    auto polygon = kraken::Navmesh::getPolygon(obstacle);
+    navmesh.addPolygon(polygon);
+
+    NavmeshQuery query;
+    std::vector<Vector2D> path;
+    Vector2D start(-1000, 1000);
+    Vector2D goal(1000, 1000);
+    REQUIRE (query.findPath(navmesh, start, goal, path));
+    REQUIRE (path.front() == start);
+    REQUIRE (path.back() == goal);
+    REQUIRE (path.size() >= 3);
+
+    //Taut around the obstacle : the corners are vertices of its polygon
+    for (std::size_t i = 1; i + 1 < path.size(); i++)
+        REQUIRE (std::find(polygon.begin(), polygon.end(), path[i]) != polygon.end());
+    float length = NavmeshQuery::getLength(path);
+    REQUIRE (length > start.distance(goal));
+    REQUIRE (length < 2300);
+    for (std::size_t i = 1; i < path.size(); i++)
+    {
+        Vector2D middle = path[i - 1] + path[i];
+        middle *= 0.5f;
+        REQUIRE (!obstacle.isColliding(middle));
+    }
+
+    //Direct line of sight
+    REQUIRE (query.findPath(navmesh, Vector2D(-1000, 200), Vector2D(1000, 300), path));
+    REQUIRE (path.size() == 2);
+    REQUIRE (query.getCorridor().size() >= 1);
+
+    //Blocked or outside goal
+    REQUIRE (!query.findPath(navmesh, start, obstacle.getPosition(), path));
+    REQUIRE (!query.findPath(navmesh, start, Vector2D(2000, 1000), path));
+    REQUIRE (path.empty());
+
+    //The buffers are reused
+    auto capacity = path.capacity();
+    REQUIRE (query.findPath(navmesh, start, goal, path));
+    REQUIRE (path.capacity() == capacity);
+
+    //One-to-many : same lengths as the single queries
+    std::vector<Vector2D> goals = {goal, Vector2D(1000, 300), obstacle.getPosition(), Vector2D(2000, 1000), start};
+    std::vector<float> lengths;
+    query.findPathLengths(navmesh, start, goals, lengths);
+    REQUIRE (lengths.size() == goals.size());
+    REQUIRE (lengths[0] == Approx(length));
+    REQUIRE (query.findPath(navmesh, start, goals[1], path));
+    REQUIRE (lengths[1] == Approx(NavmeshQuery::getLength(path)));
+    REQUIRE (std::isinf(lengths[2]));
+    REQUIRE (std::isinf(lengths[3]));
+    REQUIRE (lengths[4] == 0);
+}
+
+TEST_CASE("Navmesh update", "[navmesh]")
+{
+    using kraken::Vector2D;
+
+    kraken::Navmesh navmesh(Vector2D(-1500, 0), Vector2D(1500, 2000));
+    navmesh.addPolygon(kraken::Navmesh::getPolygon(kraken::CircularObstacle(Vector2D(-800, 500), 150)));
+    auto alive_count = [&navmesh]() {
+        int count = 0;
+        for (int triangle = 0; triangle < static_cast<int>(navmesh.getTriangleCount()); triangle++)
+            count += navmesh.getTriangle(triangle).alive;
+        return count;
+    };
+    int initial_count = alive_count();
+
+    //A square sharing a vertex with another one
+    kraken::CircularObstacle obstacle(Vector2D(0, 1000), 200);
+    int circle = navmesh.addPolygon(kraken::Navmesh::getPolygon(obstacle));
+    int square = navmesh.addPolygon({Vector2D(400, 1000), Vector2D(800, 1000), Vector2D(800, 1400),
+                                     Vector2D(400, 1400)});
+    int other = navmesh.addPolygon({Vector2D(800, 1400), Vector2D(1000, 1400), Vector2D(1000, 1600),
+                                    Vector2D(800, 1600)});
+    REQUIRE (circle != -1);
+    REQUIRE (square != circle);
+    checkTriangulation(navmesh);
+    checkOutline(navmesh, {Vector2D(400, 1000), Vector2D(800, 1000), Vector2D(800, 1400), Vector2D(400, 1400)});
+    checkOutline(navmesh, {Vector2D(800, 1400), Vector2D(1000, 1400), Vector2D(1000, 1600), Vector2D(800, 1600)});
+
+    //A square along the side of another one : the vertices of each one split the constrained edges of the other
+    int side = navmesh.addPolygon({Vector2D(800, 1050), Vector2D(950, 1050), Vector2D(950, 1350),
+                                   Vector2D(800, 1350)});
+    checkTriangulation(navmesh);
+    checkOutline(navmesh, {Vector2D(400, 1000), Vector2D(800, 1000), Vector2D(800, 1400), Vector2D(400, 1400)});
+    checkOutline(navmesh, {Vector2D(800, 1050), Vector2D(950, 1050), Vector2D(950, 1350), Vector2D(800, 1350)});
+    navmesh.removePolygon(side);
+    checkTriangulation(navmesh);
+    checkOutline(navmesh, {Vector2D(400, 1000), Vector2D(800, 1000), Vector2D(800, 1400), Vector2D(400, 1400)});
+    REQUIRE (navmesh.getTriangle(navmesh.locate(obstacle.getPosition())).blocked);
+    REQUIRE (navmesh.getTriangle(navmesh.locate(Vector2D(600, 1200))).blocked);
+
+    navmesh.removePolygon(square);
+    checkTriangulation(navmesh);
+    REQUIRE (!navmesh.getTriangle(navmesh.locate(Vector2D(600, 1200))).blocked);
+    REQUIRE (navmesh.getTriangle(navmesh.locate(Vector2D(900, 1500))).blocked);
+    REQUIRE (navmesh.getTriangle(navmesh.locate(obstacle.getPosition())).blocked);
+
+    navmesh.removePolygon(circle);
+    navmesh.removePolygon(other);
+    //Unknown or already removed
+    navmesh.removePolygon(circle);
+    navmesh.removePolygon(100);
+    navmesh.removePolygon(-1);
+    REQUIRE (!navmesh.hasPolygon(circle));
+    checkTriangulation(navmesh);
+    REQUIRE (alive_count() == initial_count);
+    REQUIRE (!navmesh.getTriangle(navmesh.locate(obstacle.getPosition())).blocked);
+    REQUIRE (!navmesh.getTriangle(navmesh.locate(Vector2D(900, 1500))).blocked);
+    REQUIRE (navmesh.getTriangle(navmesh.locate(Vector2D(-800, 500))).blocked);
+
+    //Moving obstacle : the slots are reused
+    std::size_t slot_count = navmesh.getTriangleCount();
+    for (int i = 0; i < 20; i++)
+    {
+        int moving = navmesh.addPolygon(kraken::Navmesh::getPolygon(
+                kraken::CircularObstacle(Vector2D(-1000 + 100.f * i, 1500), 120)));
+        REQUIRE (navmesh.getTriangle(navmesh.locate(Vector2D(-1000 + 100.f * i, 1500))).blocked);
+        navmesh.removePolygon(moving);
+    }
+    checkTriangulation(navmesh);
+    REQUIRE (navmesh.getTriangleCount() <= slot_count + 32);
+    REQUIRE (alive_count() == initial_count);
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> x(-1500, 1500);
+    std::uniform_real_distribution<float> y(0, 2000);
+    for (int i = 0; i < 500; i++)
+    {
+        Vector2D point(x(generator), y(generator));
+        int triangle = navmesh.locate(point);
+        REQUIRE (triangle == locateByScan(navmesh, point));
+    }
+}
+
+TEST_CASE("Polygon file", "[navmesh]")
+{
+    using kraken::Vector2D;
+
+    std::istringstream file("# fixed obstacles\n"
+                            "polygon -200 800 200 800 200 1200 -200 1200\n"
+                            "\n"
+                            "polygon 700 300 1000 300 1000 500 # triangle\n");
+    auto polygons = kraken::polygon_file::parse(file);
+    REQUIRE (polygons.size() == 2);
+    REQUIRE (polygons[0].size() == 4);
+    REQUIRE (polygons[0][2] == Vector2D(200, 1200));
+    REQUIRE (polygons[1].size() == 3);
+
+    for (auto malformed : {"polygon 0 0 1 0\n", "polygon 0 0 1 0 1 1 2\n", "polygon 0 0 1 0 1 x\n",
+                           "circle 0 0 100\n"})
+    {
+        std::istringstream strm(malformed);
+        REQUIRE_THROWS_AS (kraken::polygon_file::parse(strm), std::invalid_argument);
+    }
+}
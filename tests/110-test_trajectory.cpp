@@ -0,0 +1,160 @@
+#include "catch/catch.hpp"
+#include <cmath>
+#include <sstream>
+#include "../sources/configuration/configuration_handler.h"
+#include "../sources/planner/planner_service.h"
+#include "../sources/trajectory/tracking_monitor.h"
+#include "../sources/trajectory/trajectory_resampler.h"
+
+namespace
+{
+    struct Setpoints
+    {
+        explicit Setpoints(std::size_t capacity) : x(capacity), y(capacity), orientation(capacity),
+                                                   curvature(capacity), speed(capacity)
+        {
+        }
+
+        kraken::SetpointBuffers getBuffers(std::size_t offset, std::size_t capacity)
+        {
+            return {x.data() + offset, y.data() + offset, orientation.data() + offset, curvature.data() + offset,
+                    speed.data() + offset, capacity};
+        }
+
+        std::vector<float> x, y, orientation, curvature, speed;
+    };
+}
+
+TEST_CASE("Trajectory resampler", "[trajectory]")
+{
+    using kraken::Vector2D;
+    using kraken::ItineraryPoint;
+
+    //Straight line at 1 m/s : 1 mm per setpoint
+    std::vector<ItineraryPoint> itinerary;
+    for (int i = 0; i <= 10; i++)
+        itinerary.emplace_back(Vector2D(10.f * i, 0), 0, 0, true, 1, 1, i == 10);
+    kraken::TrajectoryResampler resampler(1);
+    resampler.reset(itinerary, 500);
+    Setpoints line(200);
+    std::size_t count = resampler.generate(line.getBuffers(0, 200));
+    REQUIRE (count == 101);
+    REQUIRE (resampler.isFinished());
+    for (std::size_t k = 0; k < count; k++)
+    {
+        REQUIRE (line.x[k] == Approx(k));
+        REQUIRE (line.y[k] == Approx(0));
+        REQUIRE (line.speed[k] == Approx(1));
+    }
+
+    //Circle of radius 1 m : the arcs stay on it
+    itinerary.clear();
+    for (int i = 0; i <= 40; i++)
+    {
+        float angle = 0.02f * i;
+        itinerary.emplace_back(Vector2D(1000 * std::sin(angle), 1000 - 1000 * std::cos(angle)), angle, 1, true,
+                               0.5f, 0.5f, i == 40);
+    }
+    resampler.reset(itinerary, 0);
+    Setpoints circle(2000);
+    count = resampler.generate(circle.getBuffers(0, 2000));
+    REQUIRE (resampler.isFinished());
+    REQUIRE (std::abs(static_cast<int>(count) - 1601) <= 1);
+    for (std::size_t k = 0; k < count; k++)
+    {
+        REQUIRE (Vector2D(circle.x[k], circle.y[k] - 1000).norm() == Approx(1000).epsilon(1e-5));
+        REQUIRE (circle.orientation[k] == Approx(std::atan2(circle.x[k], 1000 - circle.y[k])).margin(1e-4));
+        REQUIRE (circle.curvature[k] == Approx(1));
+    }
+
+    //A planned itinerary, streamed in small batches
+    kraken::ConfigurationHandler handler;
+    handler.loadFromString("[default]\nEnableDebug=false");
+    std::ostringstream statistics_stream;
+    kraken::PlannerService service(handler, statistics_stream);
+    auto context = service.createContext();
+    kraken::DynamicObstacleSet obstacles;
+    REQUIRE (context->plan(kraken::Kinematic(0, 0, 0), kraken::Kinematic(1000, 400, 0), obstacles, itinerary)
+             == kraken::SearchStatus::Success);
+
+    resampler.reset(itinerary, 0);
+    Setpoints planned(20000);
+    count = 0;
+    while (!resampler.isFinished())
+    {
+        std::size_t written = resampler.generate(planned.getBuffers(count, 7));
+        REQUIRE ((written == 7 || resampler.isFinished()));
+        count += written;
+        REQUIRE (count + 7 <= planned.x.size());
+    }
+    REQUIRE (resampler.generate(planned.getBuffers(count, 7)) == 0);
+    REQUIRE (planned.x[0] == Approx(itinerary.front().getX()));
+    REQUIRE (planned.x[count - 1] == Approx(itinerary.back().getX()));
+    REQUIRE (planned.y[count - 1] == Approx(itinerary.back().getY()));
+    REQUIRE (planned.speed[count - 1] == Approx(0).margin(1e-3));
+
+    float max_speed = 0;
+    for (const auto &point : itinerary)
+        max_speed = std::max(max_speed, point.getPossibleSpeed());
+    for (std::size_t k = 1; k < count; k++)
+    {
+        float step = Vector2D(planned.x[k], planned.y[k]).distance(Vector2D(planned.x[k - 1], planned.y[k - 1]));
+        REQUIRE (step <= max_speed * 1.1f + 0.01f);
+        REQUIRE (std::abs(planned.orientation[k] - planned.orientation[k - 1]) < 0.01f);
+        REQUIRE (planned.speed[k] <= max_speed + 1e-3f);
+    }
+}
+
+TEST_CASE("Tracking monitor", "[trajectory]")
+{
+    using kraken::Vector2D;
+    using kraken::ItineraryPoint;
+    using kraken::TrackingStatus;
+
+    //Straight line along x
+    std::vector<ItineraryPoint> itinerary;
+    for (int i = 0; i <= 100; i++)
+        itinerary.emplace_back(Vector2D(20.f * i, 0), 0, 0, true, 1, 1, i == 100);
+    kraken::TrackingMonitor monitor(100, 200);
+    REQUIRE (monitor.update(kraken::Kinematic(0, 0, 0)) == TrackingStatus::Finished);
+    monitor.reset(itinerary);
+
+    //Good tracking, with noise
+    kraken::Kinematic state;
+    for (int i = 0; i < 500; i++)
+    {
+        state.updateReal(2.f * i, 5.f * std::sin(0.1f * i), 0.02f * std::cos(0.1f * i), 0.1f);
+        REQUIRE (monitor.update(state) == TrackingStatus::OnTrack);
+        REQUIRE (itinerary[monitor.getCursor()].getX() <= 2.f * i);
+        REQUIRE (itinerary[monitor.getCursor() + 1].getX() >= 2.f * i);
+    }
+    REQUIRE (monitor.getLateralError() == Approx(5 * std::sin(49.9f)));
+    REQUIRE (monitor.getCurvatureError() == Approx(0.1f));
+
+    //Drifting to the left with a heading error : replan once, before the lateral error reaches the margin
+    float y = 0;
+    TrackingStatus status = TrackingStatus::OnTrack;
+    for (int i = 500; i < 700 && status == TrackingStatus::OnTrack; i++)
+    {
+        y += 2 * std::sin(0.2f);
+        state.updateReal(2.f * i, y, 0.2f, 0);
+        status = monitor.update(state);
+    }
+    REQUIRE (status == TrackingStatus::Replan);
+    REQUIRE (monitor.getLateralError() > 0);
+    REQUIRE (monitor.getLateralError() < 100);
+    REQUIRE (monitor.getHeadingError() == Approx(0.2f));
+    REQUIRE (monitor.getPredictedDeviation() > 100);
+    REQUIRE (monitor.update(state) == TrackingStatus::ReplanPending);
+    std::size_t rejoin = monitor.getRejoinPoint();
+    REQUIRE (itinerary[rejoin].getX() >= state.getPosition().getX() + 200);
+    REQUIRE (itinerary[rejoin].getX() <= state.getPosition().getX() + 240);
+
+    //A new itinerary resets the request
+    monitor.reset(itinerary);
+    REQUIRE (monitor.update(state) == TrackingStatus::Replan);
+    state.updateReal(2001, 0, 0, 0);
+    monitor.reset(itinerary);
+    REQUIRE (monitor.update(state) == TrackingStatus::Finished);
+    REQUIRE (monitor.getCursor() == itinerary.size() - 2);
+}
@@ -0,0 +1,148 @@
+#include "catch/catch.hpp"
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include "../sources/perfcheck/perf_baseline.h"
+#include "../sources/perfcheck/perf_scenario.h"
+
+TEST_CASE("Performance check", "[perfcheck]")
+{
+    using kraken::PerfMeasure;
+
+    std::istringstream corpus("# comment\n"
+                              "scenario first\n"
+                              "table -1500 0 1500 2000\n"
+                              "polygon -200 800 200 800 200 1200 # square\n"
+                              "circle 500 200 150\n"
+                              "config SearchTimeout=500\n"
+                              "request -1000 1000 0 1000 1000 0\n"
+                              "\n"
+                              "scenario second\n"
+                              "request 0 0 0 1000 400 0\n");
+    auto scenarios = kraken::perf_scenario::parse(corpus);
+    REQUIRE (scenarios.size() == 2);
+    REQUIRE (scenarios[0].has_table);
+    REQUIRE (scenarios[0].polygons.size() == 1);
+    REQUIRE (scenarios[0].polygons[0].size() == 3);
+    REQUIRE (scenarios[0].circles.size() == 1);
+    REQUIRE (scenarios[0].configuration.size() == 1);
+    REQUIRE (scenarios[1].requests.size() == 1);
+    REQUIRE (!scenarios[1].has_table);
+
+    for (auto malformed : {"request 0 0 0 1 1 1\n", "scenario a\nrequest 0 0 0 1 1\n", "scenario a\ncircle 0 0 x\n",
+                           "scenario a\nteleport 0 0\n", "scenario a\npolygon 0 0 1 0 1 1\n"})
+    {
+        std::istringstream strm(malformed);
+        REQUIRE_THROWS_AS(kraken::perf_scenario::parse(strm), std::invalid_argument);
+    }
+
+    auto measure = kraken::perf_scenario::run(scenarios[1], 3);
+    REQUIRE (measure.name == "second");
+    REQUIRE (measure.requests.size() == 1);
+    REQUIRE (measure.requests[0].latencies_us.size() == 3);
+    REQUIRE (measure.latencies_us == measure.requests[0].latencies_us);
+    REQUIRE (measure.failures == 0);
+    REQUIRE (measure.nodes_expanded > 0);
+    REQUIRE (measure.nodes_expanded == measure.requests[0].nodes_expanded);
+    REQUIRE (measure.p50_us <= measure.p99_us);
+    REQUIRE (kraken::perf_scenario::getPercentile({1, 2, 3, 4}, 50) == 2);
+    REQUIRE (kraken::perf_scenario::getPercentile({1, 2, 3, 4}, 99) == 4);
+
+    //Baseline round trip
+    std::stringstream baseline_file;
+    kraken::perf_baseline::write(baseline_file, "Release", {measure});
+    std::string build_type;
+    auto baseline = kraken::perf_baseline::parse(baseline_file, build_type);
+    REQUIRE (build_type == "Release");
+    REQUIRE (baseline.size() == 1);
+    REQUIRE (baseline[0].scenario == "second");
+    REQUIRE (baseline[0].request == 0);
+    REQUIRE (baseline[0].nodes_expanded == measure.nodes_expanded);
+    for (auto malformed : {"build Release\nsecond 0 10 20\n", "second 0 10 20 30\n", "# comment\n",
+                           "build\nsecond 0 10 20 30\n"})
+    {
+        std::istringstream strm(malformed);
+        REQUIRE_THROWS_AS(kraken::perf_baseline::parse(strm, build_type), std::invalid_argument);
+    }
+
+    REQUIRE (kraken::perf_baseline::getBinomialTail(4, 0) == 1);
+    REQUIRE (kraken::perf_baseline::getBinomialTail(4, 3) == Approx(5. / 16));
+    REQUIRE (kraken::perf_baseline::getBinomialTail(4, 5) == 0);
+
+    //Comparisons on synthetic latencies
+    kraken::PerfBaselineEntry entry;
+    entry.scenario = "synthetic";
+    entry.p50_us = 1000;
+    entry.p99_us = 2000;
+    entry.nodes_expanded = 100;
+    kraken::PerfRequestMeasure synthetic;
+    synthetic.nodes_expanded = 100;
+    for (std::uint32_t i = 0; i < 100; i++)
+        synthetic.latencies_us.push_back(950 + i);
+    synthetic.p50_us = 1000;
+    synthetic.p99_us = 1049;
+    auto compare = [&](const kraken::PerfBaselineEntry *baseline_entry) {
+        std::vector<kraken::PerfComparison> comparisons{
+                kraken::perf_baseline::compare(baseline_entry, "synthetic", 0, synthetic, 0.1f)};
+        kraken::perf_baseline::correct(comparisons, 0.01);
+        return comparisons[0];
+    };
+    REQUIRE (!compare(&entry).isRegression());
+
+    //A few slow outliers are not significant
+    synthetic.latencies_us[0] = synthetic.latencies_us[1] = 5000;
+    REQUIRE (!compare(&entry).slower);
+
+    //The whole distribution moved by 30%
+    for (auto &latency : synthetic.latencies_us)
+        latency = latency * 13 / 10;
+    auto comparison = compare(&entry);
+    REQUIRE (comparison.slower);
+    REQUIRE (comparison.isRegression());
+
+    synthetic.latencies_us.assign(100, 1000);
+    synthetic.nodes_expanded = 120;
+    comparison = compare(&entry);
+    REQUIRE (!comparison.slower);
+    REQUIRE (comparison.more_nodes);
+
+    synthetic.nodes_expanded = 100;
+    synthetic.failed = true;
+    REQUIRE (compare(&entry).isRegression());
+    synthetic.failed = false;
+    comparison = compare(nullptr);
+    REQUIRE (!comparison.has_baseline);
+    REQUIRE (!comparison.isRegression());
+
+    //Holm correction : p-values significant alone are not once there are many tests
+    std::vector<kraken::PerfComparison> comparisons(10);
+    for (std::size_t i = 0; i < comparisons.size(); i++)
+    {
+        comparisons[i].has_baseline = true;
+        comparisons[i].sign_test_p = 0.005;
+    }
+    comparisons[3].sign_test_p = 0.0005;
+    kraken::perf_baseline::correct(comparisons, 0.01);
+    REQUIRE (comparisons[3].slower);
+    REQUIRE (std::count_if(comparisons.begin(), comparisons.end(),
+                           [](const kraken::PerfComparison &c) { return c.slower; }) == 1);
+
+    //Per request baselines : only the slower request of the scenario is reported
+    PerfMeasure measured;
+    measured.name = "synthetic";
+    measured.requests.resize(2);
+    std::vector<kraken::PerfBaselineEntry> entries(2, entry);
+    entries[1].request = 1;
+    entries[1].p50_us = 500;
+    for (auto &request : measured.requests)
+    {
+        request.latencies_us.assign(20, 1000);
+        request.p50_us = 1000;
+        request.nodes_expanded = 100;
+    }
+    auto results = kraken::perf_baseline::compare(entries, {measured}, 0.1f);
+    REQUIRE (results.size() == 2);
+    REQUIRE (!results[0].slower);
+    REQUIRE (results[1].slower);
+    REQUIRE (results[1].request == 1);
+}
@@ -0,0 +1,219 @@
+#include "catch/catch.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "../sources/api/kraken_api.h"
+#include "../sources/configuration/configuration_handler.h"
+#include "../sources/daemon/plan_protocol.h"
+#include "../sources/daemon/plan_server.h"
+#include "../sources/planner/planner_service.h"
+
+TEST_CASE("C API", "[daemon]")
+{
+    REQUIRE (kraken_api_version() == KRAKEN_API_VERSION);
+    kraken_planner *planner = kraken_create("[default]\nEnableDebug=false\nPlanCacheSize=0");
+    REQUIRE (planner != nullptr);
+
+    kraken_kinematic start = {0, 0, 0, 0, 1};
+    kraken_kinematic goal = {1000, 400, 0, 0, 1};
+    kraken_circle obstacle = {500, 200, 150};
+    kraken_itinerary_point itinerary[500];
+    size_t point_count = 0;
+    REQUIRE (kraken_plan(planner, &start, &goal, &obstacle, 1, itinerary, 500, &point_count) == KRAKEN_SUCCESS);
+    REQUIRE (point_count > 2);
+    REQUIRE (itinerary[0].x == 0);
+    REQUIRE (itinerary[point_count - 1].stop);
+    for (size_t i = 0; i < point_count; i++)
+        REQUIRE ((itinerary[i].x - 500) * (itinerary[i].x - 500) + (itinerary[i].y - 200) * (itinerary[i].y - 200)
+                 > 150 * 150);
+
+    //The required size is given when the buffer is too small
+    size_t required = point_count;
+    REQUIRE (kraken_plan(planner, &start, &goal, nullptr, 0, itinerary, 1, &point_count) == KRAKEN_BUFFER_TOO_SMALL);
+    REQUIRE (point_count > 1);
+    REQUIRE (point_count <= required);
+    REQUIRE (kraken_plan(planner, &start, nullptr, nullptr, 0, itinerary, 500, &point_count)
+             == KRAKEN_INVALID_ARGUMENT);
+
+    //Fixed obstacles in the navmesh of the table, here on the goal
+    REQUIRE (kraken_add_fixed_obstacle(planner, nullptr, 0) == -1);
+    REQUIRE (kraken_set_table(planner, -1500, -1000, 1500, 1000) == KRAKEN_SUCCESS);
+    float square[] = {800, 200, 1200, 200, 1200, 600, 800, 600};
+    int fixed_obstacle = kraken_add_fixed_obstacle(planner, square, 4);
+    REQUIRE (fixed_obstacle >= 0);
+    REQUIRE (kraken_plan(planner, &start, &goal, nullptr, 0, itinerary, 500, &point_count) == KRAKEN_NO_PATH);
+    REQUIRE (std::string(kraken_status_name(KRAKEN_NO_PATH)) == "NoPath");
+    REQUIRE (kraken_remove_fixed_obstacle(planner, fixed_obstacle) == KRAKEN_SUCCESS);
+    REQUIRE (kraken_plan(planner, &start, &goal, nullptr, 0, itinerary, 500, &point_count) == KRAKEN_SUCCESS);
+    REQUIRE (kraken_remove_fixed_obstacle(planner, fixed_obstacle) == KRAKEN_INVALID_ARGUMENT);
+    REQUIRE (kraken_remove_fixed_obstacle(planner, fixed_obstacle + 1) == KRAKEN_INVALID_ARGUMENT);
+    REQUIRE (kraken_remove_fixed_obstacle(planner, -1) == KRAKEN_INVALID_ARGUMENT);
+    REQUIRE (kraken_remove_fixed_obstacle(nullptr, 0) == KRAKEN_INVALID_ARGUMENT);
+
+    //The obstacle set follows ObstaclesMemoryPoolSize
+    kraken_circle two_obstacles[] = {{500, 200, 150}, {-500, 200, 150}};
+    REQUIRE (kraken_load_configuration(planner, "[default]\nObstaclesMemoryPoolSize=1") == KRAKEN_SUCCESS);
+    REQUIRE (kraken_plan(planner, &start, &goal, two_obstacles, 1, itinerary, 500, &point_count) == KRAKEN_SUCCESS);
+    REQUIRE (kraken_plan(planner, &start, &goal, two_obstacles, 2, itinerary, 500, &point_count)
+             == KRAKEN_INVALID_ARGUMENT);
+    REQUIRE (kraken_load_configuration(planner, "[default]\nObstaclesMemoryPoolSize=2") == KRAKEN_SUCCESS);
+    REQUIRE (kraken_plan(planner, &start, &goal, two_obstacles, 2, itinerary, 500, &point_count) == KRAKEN_SUCCESS);
+
+    REQUIRE (kraken_load_configuration(planner, "[default]\nNodeMemoryPoolSize=3") == KRAKEN_SUCCESS);
+    REQUIRE (kraken_plan(planner, &start, &goal, nullptr, 0, itinerary, 500, &point_count)
+             == KRAKEN_POOL_EXHAUSTED);
+    kraken_destroy(planner);
+
+    //Configuration given at the creation
+    planner = kraken_create("[default]\nEnableDebug=false\nObstaclesMemoryPoolSize=1");
+    REQUIRE (planner != nullptr);
+    REQUIRE (kraken_plan(planner, &start, &goal, two_obstacles, 2, itinerary, 500, &point_count)
+             == KRAKEN_INVALID_ARGUMENT);
+    kraken_destroy(planner);
+}
+
+TEST_CASE("Plan protocol", "[daemon]")
+{
+    using kraken::Vector2D;
+
+    kraken::PlanMessage message;
+    message.id = 42;
+    message.start = kraken::Kinematic(10, 20, 0.5f, false, 1.5f, true);
+    message.goal = kraken::Kinematic(1000, 400, -1);
+    message.obstacles.emplace_back(Vector2D(500, 200), 150);
+    std::vector<std::uint8_t> frame;
+    kraken::plan_protocol::encode(message, frame);
+    REQUIRE (frame.size() == 4 + 1 + 4 + 2 * 17 + 2 + 12);
+    REQUIRE (frame[0] == frame.size() - 4);
+
+    kraken::PlanMessage decoded;
+    kraken::plan_protocol::decode(frame.data() + 4, frame.size() - 4, decoded);
+    REQUIRE (decoded.id == 42);
+    REQUIRE (decoded.start.getPosition() == message.start.getPosition());
+    REQUIRE (decoded.start.getGeometricCurvature() == 1.5f);
+    REQUIRE (!decoded.start.getGoingForward());
+    REQUIRE (decoded.start.getStop());
+    REQUIRE (decoded.obstacles == message.obstacles);
+
+    kraken::PlanReply reply;
+    reply.id = 7;
+    reply.status = kraken::SearchStatus::PoolExhausted;
+    reply.latency_us = 1234;
+    reply.itinerary.emplace_back(Vector2D(1, 2), 0.1f, 0.2f, true, 1.f, 0.5f, false);
+    reply.itinerary.emplace_back(Vector2D(3, 4), 0.3f, 0.4f, false, 1.f, 0.f, true);
+    kraken::plan_protocol::encode(reply, frame);
+    kraken::PlanReply decoded_reply;
+    kraken::plan_protocol::decode(frame.data() + 4, frame.size() - 4, decoded_reply);
+    REQUIRE (decoded_reply.id == 7);
+    REQUIRE (decoded_reply.status == kraken::SearchStatus::PoolExhausted);
+    REQUIRE (decoded_reply.latency_us == 1234);
+    REQUIRE (decoded_reply.itinerary == reply.itinerary);
+
+    //The obstacle count is encoded on 16 bits
+    message.obstacles.assign(65536, kraken::CircularObstacle(Vector2D(500, 200), 150));
+    REQUIRE_THROWS_AS (kraken::plan_protocol::encode(message, frame), std::invalid_argument);
+    message.obstacles.pop_back();
+    kraken::plan_protocol::encode(message, frame);
+    kraken::plan_protocol::decode(frame.data() + 4, frame.size() - 4, decoded);
+    REQUIRE (decoded.obstacles.size() == 65535);
+    kraken::plan_protocol::encode(reply, frame);
+
+    //Truncated, trailing bytes, other version
+    REQUIRE_THROWS_AS (kraken::plan_protocol::decode(frame.data() + 4, frame.size() - 5, decoded_reply),
+                       std::invalid_argument);
+    frame.push_back(0);
+    REQUIRE_THROWS_AS (kraken::plan_protocol::decode(frame.data() + 4, frame.size() - 4, decoded_reply),
+                       std::invalid_argument);
+    frame[4] = kraken::plan_protocol::version + 1;
+    REQUIRE_THROWS_AS (kraken::plan_protocol::decode(frame.data() + 4, frame.size() - 5, decoded_reply),
+                       std::invalid_argument);
+}
+
+TEST_CASE("Plan server", "[daemon]")
+{
+    kraken::ConfigurationHandler handler;
+    handler.loadFromString("[default]\nEnableDebug=false\nObstaclesMemoryPoolSize=3");
+    std::ostringstream statistics_stream;
+    kraken::PlannerService service(handler, statistics_stream);
+
+    std::string socket_path = "kraken_test_" + std::to_string(::getpid()) + ".sock";
+    std::atomic<bool> stop(false);
+    kraken::PlanServer server(service, socket_path);
+    std::thread server_thread([&] { server.run(stop); });
+
+    int client = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    std::strcpy(address.sun_path, socket_path.c_str());
+    REQUIRE (::connect(client, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0);
+
+    //Two pipelined requests, answered in order
+    kraken::PlanMessage message;
+    message.start = kraken::Kinematic(0, 0, 0);
+    message.goal = kraken::Kinematic(1000, 400, 0);
+    std::vector<std::uint8_t> frame;
+    for (std::uint32_t id = 1; id <= 2; id++)
+    {
+        message.id = id;
+        if (id == 2)
+            message.obstacles.emplace_back(kraken::Vector2D(1000, 400), 400);
+        kraken::plan_protocol::encode(message, frame);
+        REQUIRE (kraken::plan_protocol::writeFrame(client, frame));
+    }
+    kraken::PlanReply reply;
+    REQUIRE (kraken::plan_protocol::readFrame(client, frame));
+    kraken::plan_protocol::decode(frame.data(), frame.size(), reply);
+    REQUIRE (reply.id == 1);
+    REQUIRE (reply.status == kraken::SearchStatus::Success);
+    REQUIRE (!reply.itinerary.empty());
+    REQUIRE (reply.latency_us > 0);
+    REQUIRE (kraken::plan_protocol::readFrame(client, frame));
+    kraken::plan_protocol::decode(frame.data(), frame.size(), reply);
+    REQUIRE (reply.id == 2);
+    REQUIRE (reply.status != kraken::SearchStatus::Success);
+
+    //More obstacles than the capacity : not planned rather than planned without some of them
+    message.id = 3;
+    message.obstacles.clear();
+    for (int i = 0; i < 4; i++)
+        message.obstacles.emplace_back(kraken::Vector2D(-500, 200.f * i), 50);
+    kraken::plan_protocol::encode(message, frame);
+    REQUIRE (kraken::plan_protocol::writeFrame(client, frame));
+    REQUIRE (kraken::plan_protocol::readFrame(client, frame));
+    kraken::plan_protocol::decode(frame.data(), frame.size(), reply);
+    REQUIRE (reply.id == 3);
+    REQUIRE (reply.status == kraken::SearchStatus::PoolExhausted);
+    REQUIRE (reply.itinerary.empty());
+    message.id = 4;
+    message.obstacles.pop_back();
+    kraken::plan_protocol::encode(message, frame);
+    REQUIRE (kraken::plan_protocol::writeFrame(client, frame));
+    REQUIRE (kraken::plan_protocol::readFrame(client, frame));
+    kraken::plan_protocol::decode(frame.data(), frame.size(), reply);
+    REQUIRE (reply.id == 4);
+    REQUIRE (reply.status == kraken::SearchStatus::Success);
+
+    //A malformed frame closes the connection
+    frame.assign({1, 0, 0, 0, 99});
+    REQUIRE (kraken::plan_protocol::writeFrame(client, frame));
+    REQUIRE (!kraken::plan_protocol::readFrame(client, frame));
+    ::close(client);
+
+    //A client stalled in the middle of a frame doesn't block the stop
+    client = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    REQUIRE (::connect(client, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0);
+    frame.assign({100, 0, 0, 0, 1});
+    REQUIRE (kraken::plan_protocol::writeFrame(client, frame));
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    auto begin = std::chrono::steady_clock::now();
+    stop.store(true);
+    server_thread.join();
+    REQUIRE (std::chrono::steady_clock::now() - begin < std::chrono::seconds(1));
+    ::close(client);
+}
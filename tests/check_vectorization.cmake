@@ -0,0 +1,26 @@
+# Compiles the trajectory resampler with the vectorization report of GCC, and fails if the loop over the samples of
+# an arc (TrajectoryResampler::evaluateArc) is not vectorized.
+# Arguments : -DCOMPILER=<g++> -DSOURCE=<trajectory_resampler.cpp> -DOUTPUT=<object file>
+
+file(READ ${SOURCE} content)
+string(FIND "${content}" "TrajectoryResampler::evaluateArc(" function_position)
+if(function_position EQUAL -1)
+    message(FATAL_ERROR "TrajectoryResampler::evaluateArc not found in ${SOURCE}")
+endif()
+string(SUBSTRING "${content}" ${function_position} -1 function)
+string(FIND "${function}" "for (" loop_offset)
+math(EXPR loop_position "${function_position} + ${loop_offset}")
+string(SUBSTRING "${content}" 0 ${loop_position} before_loop)
+string(REGEX MATCHALL "\n" newlines "${before_loop}")
+list(LENGTH newlines loop_line)
+math(EXPR loop_line "${loop_line} + 1")
+
+execute_process(COMMAND ${COMPILER} -std=c++11 -O3 -DDEBUG=1 -fopt-info-vec-optimized -c ${SOURCE} -o ${OUTPUT}
+                RESULT_VARIABLE result ERROR_VARIABLE report OUTPUT_VARIABLE report)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Cannot compile ${SOURCE}:\n${report}")
+endif()
+if(NOT report MATCHES "trajectory_resampler.cpp:${loop_line}:[0-9]+: optimized: loop vectorized")
+    message(FATAL_ERROR "The loop at line ${loop_line} of ${SOURCE} is not vectorized:\n${report}")
+endif()
+message(STATUS "The loop at line ${loop_line} of ${SOURCE} is vectorized")